@@ -6,6 +6,203 @@
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Subsystems/SaveSystem/SaveableRegistrySubsystem.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+// ============================================================================
+// CONSOLE COMMAND REGISTRATION
+// ============================================================================
+
+static FAutoConsoleCommandWithWorldAndArgs GCmdAuditEconomy(
+	TEXT("WW.AuditEconomy"),
+	TEXT("Rebuild the balance from the transaction log and verify it exactly. Usage: WW.AuditEconomy"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&UEconomySubsystem::CmdAuditEconomy)
+);
+
+namespace EconomySubsystemPrivate
+{
+	static const TCHAR* SaveID = TEXT("EconomySubsystem");
+
+	static void SerializeTransaction(FArchive& Ar, FEconomyTransaction& Transaction)
+	{
+		FName CategoryName = Transaction.Category.GetTagName();
+		Ar << Transaction.AmountMinor;
+		Ar << CategoryName;
+		Ar << Transaction.Description;
+		Ar << Transaction.Timestamp;
+
+		if (Ar.IsLoading())
+		{
+			Transaction.Category = FGameplayTag::RequestGameplayTag(CategoryName, false);
+			Transaction.Amount = EconomyMoney::ToFloat(Transaction.AmountMinor);
+		}
+	}
+}
+
+// ============================================================================
+// TRANSACTION LEDGER
+// ============================================================================
+
+FTransactionLedger::FTransactionLedger(int32 InCapacity)
+{
+	Slots.SetNum(FMath::Max(1, InCapacity));
+}
+
+void FTransactionLedger::Add(const FEconomyTransaction& Transaction)
+{
+	if (Count == Slots.Num())
+	{
+		EvictOldest();
+	}
+
+	const uint64 Sequence = NextSequence++;
+	Slots[Sequence % Slots.Num()] = Transaction;
+	Count++;
+
+	FCategoryWindow& Window = Categories.FindOrAdd(Transaction.Category);
+	Window.Sequences.Add(Sequence);
+	Window.Total += Transaction.AmountMinor;
+}
+
+void FTransactionLedger::EvictOldest()
+{
+	const uint64 Oldest = NextSequence - Count;
+	const FEconomyTransaction& Evicted = GetBySequence(Oldest);
+
+	FCategoryWindow* Window = Categories.Find(Evicted.Category);
+	check(Window && Window->Num() > 0 && Window->Sequences[Window->Head] == Oldest);
+
+	OpeningBalance += Evicted.AmountMinor;
+	Window->Total -= Evicted.AmountMinor;
+	Window->Head++;
+	if (Window->Num() == 0)
+	{
+		Categories.Remove(Evicted.Category);
+	}
+	else if (Window->Head >= 32 && Window->Head * 2 >= Window->Sequences.Num())
+	{
+		// Compact once the consumed prefix dominates - amortized O(1) per eviction
+		Window->Sequences.RemoveAt(0, Window->Head, EAllowShrinking::No);
+		Window->Head = 0;
+	}
+
+	Count--;
+}
+
+void FTransactionLedger::Reset(int64 InOpeningBalance)
+{
+	for (FEconomyTransaction& Slot : Slots)
+	{
+		Slot = FEconomyTransaction();
+	}
+	Count = 0;
+	NextSequence = 0;
+	OpeningBalance = InOpeningBalance;
+	Categories.Reset();
+}
+
+void FTransactionLedger::GetRecent(int32 MaxCount, TArray<FEconomyTransaction>& OutTransactions) const
+{
+	const int32 Num = FMath::Clamp(MaxCount, 0, Count);
+	OutTransactions.Reserve(OutTransactions.Num() + Num);
+	for (int32 i = 1; i <= Num; ++i)
+	{
+		OutTransactions.Add(GetBySequence(NextSequence - i));
+	}
+}
+
+void FTransactionLedger::GetByCategory(const FGameplayTag& Category, TArray<FEconomyTransaction>& OutTransactions) const
+{
+	const FCategoryWindow* Window = Categories.Find(Category);
+	if (!Window) return;
+
+	OutTransactions.Reserve(OutTransactions.Num() + Window->Num());
+	for (int32 i = Window->Head; i < Window->Sequences.Num(); ++i)
+	{
+		OutTransactions.Add(GetBySequence(Window->Sequences[i]));
+	}
+}
+
+int64 FTransactionLedger::GetCategoryTotal(const FGameplayTag& Category) const
+{
+	const FCategoryWindow* Window = Categories.Find(Category);
+	return Window ? Window->Total : 0;
+}
+
+bool FTransactionLedger::Verify(int64& OutClosingBalance, FString& OutError) const
+{
+	int64 Closing = OpeningBalance;
+	TMap<FGameplayTag, TPair<int64, int32>> Recount;
+
+	for (uint64 Sequence = NextSequence - Count; Sequence < NextSequence; ++Sequence)
+	{
+		const FEconomyTransaction& Transaction = GetBySequence(Sequence);
+		if (!EconomyMoney::CheckedAdd(Closing, Transaction.AmountMinor, Closing))
+		{
+			OutError = FString::Printf(TEXT("balance overflows at transaction %llu"), Sequence);
+			return false;
+		}
+
+		TPair<int64, int32>& Sums = Recount.FindOrAdd(Transaction.Category);
+		Sums.Key += Transaction.AmountMinor;
+		Sums.Value++;
+	}
+	OutClosingBalance = Closing;
+
+	if (Recount.Num() != Categories.Num())
+	{
+		OutError = FString::Printf(TEXT("%d categories in the history, %d category windows"), Recount.Num(), Categories.Num());
+		return false;
+	}
+
+	for (const auto& Pair : Recount)
+	{
+		const FCategoryWindow* Window = Categories.Find(Pair.Key);
+		if (!Window || Window->Total != Pair.Value.Key || Window->Num() != Pair.Value.Value)
+		{
+			OutError = FString::Printf(TEXT("category '%s' rolling total %s over %d entries, recount %s over %d"),
+				*Pair.Key.ToString(), *EconomyMoney::Format(Window ? Window->Total : 0), Window ? Window->Num() : 0,
+				*EconomyMoney::Format(Pair.Value.Key), Pair.Value.Value);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FTransactionLedger::Serialize(FArchive& Ar)
+{
+	int64 SavedOpeningBalance = OpeningBalance;
+	int32 NumEntries = Count;
+	Ar << SavedOpeningBalance;
+	Ar << NumEntries;
+
+	if (Ar.IsLoading())
+	{
+		Reset(SavedOpeningBalance);
+		for (int32 i = 0; i < NumEntries && !Ar.IsError(); ++i)
+		{
+			FEconomyTransaction Transaction;
+			EconomySubsystemPrivate::SerializeTransaction(Ar, Transaction);
+			Add(Transaction);
+		}
+	}
+	else
+	{
+		for (uint64 Sequence = NextSequence - Count; Sequence < NextSequence; ++Sequence)
+		{
+			FEconomyTransaction Transaction = GetBySequence(Sequence);
+			EconomySubsystemPrivate::SerializeTransaction(Ar, Transaction);
+		}
+	}
+}
+
+// ============================================================================
+// LIFECYCLE
+// ============================================================================
 
 UEconomySubsystem::UEconomySubsystem()
 {
@@ -13,16 +210,27 @@ UEconomySubsystem::UEconomySubsystem()
 
 void UEconomySubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
+	Collection.InitializeDependency<USaveableRegistrySubsystem>();
 	Super::Initialize(Collection);
 
-	TransactionHistory.Reserve(MaxTransactionHistory);
+	// Register with save system
+	if (USaveableRegistrySubsystem* Registry = USaveableRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterSaveable(this);
+	}
 }
 
 void UEconomySubsystem::Deinitialize()
 {
+	// Unregister from save system
+	if (USaveableRegistrySubsystem* Registry = USaveableRegistrySubsystem::Get(this))
+	{
+		Registry->UnregisterSaveable(EconomySubsystemPrivate::SaveID);
+	}
+
 	StopBillingCycle();
 	RegisteredConsumers.Empty();
-	TransactionHistory.Empty();
+	TransactionHistory.Reset();
 	BillingEntries.Empty();
 
 	Super::Deinitialize();
@@ -56,55 +264,96 @@ UEconomySubsystem* UEconomySubsystem::Get(const UObject* WorldContextObject)
 
 float UEconomySubsystem::AddFunds(float Amount, FGameplayTag Category, const FString& Description, AActor* Source)
 {
-	if (Amount <= 0.f)
+	int64 AmountMinor = 0;
+	if (!EconomyMoney::FromFloat(Amount, AmountMinor) || AmountMinor <= 0)
 	{
-		return Balance;
+		return GetBalance();
 	}
 
-	const float OldBalance = Balance;
-	Balance += Amount;
-
-	// Record transaction
-	FEconomyTransaction Transaction;
-	Transaction.Amount = Amount;
-	Transaction.Category = Category;
-	Transaction.Description = Description;
-	Transaction.SourceActor = Source;
-
-	UWorld* World = GetWorldForTimers();
-	Transaction.Timestamp = World ? World->GetTimeSeconds() : 0.f;
+	ApplyTransaction(AmountMinor, Category, Description, Source);
+	return GetBalance();
+}
 
-	RecordTransaction(Transaction);
+bool UEconomySubsystem::DeductFunds(float Amount, FGameplayTag Category, const FString& Description, AActor* Source, bool bAllowDebt)
+{
+	int64 AmountMinor = 0;
+	if (!EconomyMoney::FromFloat(Amount, AmountMinor) || AmountMinor <= 0)
+	{
+		return false;
+	}
 
-	// Update running totals
-	TotalIncome += Amount;
-	IncomeTotals.FindOrAdd(Category) += Amount;
+	if (!bAllowDebt && BalanceMinor < AmountMinor)
+	{
+		return false;
+	}
 
-	// Broadcast
-	OnBalanceChanged.Broadcast(Balance, Amount);
-	OnTransactionProcessed.Broadcast(Amount, Category, Balance);
+	return ApplyTransaction(-AmountMinor, Category, Description, Source);
+}
 
-	return Balance;
+bool UEconomySubsystem::CanAfford(float Amount) const
+{
+	int64 AmountMinor = 0;
+	return EconomyMoney::FromFloat(Amount, AmountMinor) && BalanceMinor >= AmountMinor;
 }
 
-bool UEconomySubsystem::DeductFunds(float Amount, FGameplayTag Category, const FString& Description, AActor* Source, bool bAllowDebt)
+void UEconomySubsystem::SetBalance(float NewBalance)
 {
-	if (Amount <= 0.f)
+	int64 NewBalanceMinor = 0;
+	int64 DeltaMinor = 0;
+	if (!EconomyMoney::FromFloat(NewBalance, NewBalanceMinor) || !EconomyMoney::CheckedAdd(NewBalanceMinor, -BalanceMinor, DeltaMinor))
 	{
-		return false;
+		UE_LOG(LogTemp, Warning, TEXT("EconomySubsystem::SetBalance - %f is out of range"), NewBalance);
+		return;
 	}
 
-	if (!bAllowDebt && Balance < Amount)
+	// Not a transaction - folded into the history's opening balance so the audit still reconciles
+	BalanceMinor = NewBalanceMinor;
+	TransactionHistory.AdjustOpeningBalance(DeltaMinor);
+	MarkSaveDirty();
+
+	OnBalanceChanged.Broadcast(GetBalance(), EconomyMoney::ToFloat(DeltaMinor));
+
+	if (BalanceMinor < 0)
 	{
+		OnBalanceNegative.Broadcast(GetBalance());
+	}
+}
+
+bool UEconomySubsystem::ApplyTransaction(int64 AmountMinor, const FGameplayTag& Category, const FString& Description, AActor* Source)
+{
+	// Overflow-check everything before touching any state
+	int64 NewBalance = 0;
+	int64 NewTotalIncome = TotalIncomeMinor;
+	int64 NewTotalExpenses = TotalExpensesMinor;
+	const bool bInRange = EconomyMoney::CheckedAdd(BalanceMinor, AmountMinor, NewBalance)
+		&& (AmountMinor > 0
+			? EconomyMoney::CheckedAdd(TotalIncomeMinor, AmountMinor, NewTotalIncome)
+			: EconomyMoney::CheckedAdd(TotalExpensesMinor, -AmountMinor, NewTotalExpenses));
+	if (!bInRange)
+	{
+		UE_LOG(LogTemp, Error, TEXT("EconomySubsystem::ApplyTransaction - %s on balance %s overflows, rejected (%s)"),
+			*EconomyMoney::Format(AmountMinor), *EconomyMoney::Format(BalanceMinor), *Description);
 		return false;
 	}
 
-	const float OldBalance = Balance;
-	Balance -= Amount;
+	BalanceMinor = NewBalance;
+	TotalIncomeMinor = NewTotalIncome;
+	TotalExpensesMinor = NewTotalExpenses;
+
+	// Per-category totals are bounded by the lifetime totals checked above
+	if (AmountMinor > 0)
+	{
+		IncomeTotals.FindOrAdd(Category) += AmountMinor;
+	}
+	else
+	{
+		ExpenseTotals.FindOrAdd(Category) -= AmountMinor;
+	}
 
 	// Record transaction
 	FEconomyTransaction Transaction;
-	Transaction.Amount = -Amount;
+	Transaction.Amount = EconomyMoney::ToFloat(AmountMinor);
+	Transaction.AmountMinor = AmountMinor;
 	Transaction.Category = Category;
 	Transaction.Description = Description;
 	Transaction.SourceActor = Source;
@@ -113,99 +362,102 @@ bool UEconomySubsystem::DeductFunds(float Amount, FGameplayTag Category, const F
 	Transaction.Timestamp = World ? World->GetTimeSeconds() : 0.f;
 
 	RecordTransaction(Transaction);
-
-	// Update running totals
-	TotalExpenses += Amount;
-	ExpenseTotals.FindOrAdd(Category) += Amount;
+	MarkSaveDirty();
 
 	// Broadcast
-	OnBalanceChanged.Broadcast(Balance, -Amount);
-	OnTransactionProcessed.Broadcast(-Amount, Category, Balance);
+	OnBalanceChanged.Broadcast(GetBalance(), Transaction.Amount);
+	OnTransactionProcessed.Broadcast(Transaction.Amount, Category, GetBalance());
 
-	if (Balance < 0.f)
+	if (AmountMinor < 0 && BalanceMinor < 0)
 	{
-		OnBalanceNegative.Broadcast(Balance);
+		OnBalanceNegative.Broadcast(GetBalance());
 	}
 
 	return true;
 }
 
-void UEconomySubsystem::SetBalance(float NewBalance)
-{
-	const float Delta = NewBalance - Balance;
-	Balance = NewBalance;
-
-	OnBalanceChanged.Broadcast(Balance, Delta);
-
-	if (Balance < 0.f)
-	{
-		OnBalanceNegative.Broadcast(Balance);
-	}
-}
-
 // ============================================================================
 // TRANSACTION HISTORY
 // ============================================================================
 
 TArray<FEconomyTransaction> UEconomySubsystem::GetRecentTransactions(int32 Count) const
 {
-	const int32 Num = FMath::Min(Count, TransactionHistory.Num());
+	// Most recent first
 	TArray<FEconomyTransaction> Result;
-	Result.Reserve(Num);
-
-	// Return most recent first (history is stored oldest-first)
-	for (int32 i = TransactionHistory.Num() - 1; i >= TransactionHistory.Num() - Num; --i)
-	{
-		Result.Add(TransactionHistory[i]);
-	}
-
+	TransactionHistory.GetRecent(Count, Result);
 	return Result;
 }
 
 TArray<FEconomyTransaction> UEconomySubsystem::GetTransactionsByCategory(FGameplayTag Category) const
 {
+	// Oldest first, exact category match
 	TArray<FEconomyTransaction> Result;
-
-	for (const FEconomyTransaction& Transaction : TransactionHistory)
-	{
-		if (Transaction.Category.MatchesTagExact(Category))
-		{
-			Result.Add(Transaction);
-		}
-	}
-
+	TransactionHistory.GetByCategory(Category, Result);
 	return Result;
 }
 
+float UEconomySubsystem::GetHistoryTotalByCategory(FGameplayTag Category) const
+{
+	return EconomyMoney::ToFloat(TransactionHistory.GetCategoryTotal(Category));
+}
+
 FFinancialSummary UEconomySubsystem::GetFinancialSummary() const
 {
 	FFinancialSummary Summary;
-	Summary.Balance = Balance;
-	Summary.TotalIncome = TotalIncome;
-	Summary.TotalExpenses = TotalExpenses;
-	Summary.NetProfit = TotalIncome - TotalExpenses;
-	Summary.IncomeByCategory = IncomeTotals;
-	Summary.ExpensesByCategory = ExpenseTotals;
+	Summary.Balance = GetBalance();
+	Summary.TotalIncome = EconomyMoney::ToFloat(TotalIncomeMinor);
+	Summary.TotalExpenses = EconomyMoney::ToFloat(TotalExpensesMinor);
+	Summary.NetProfit = EconomyMoney::ToFloat(TotalIncomeMinor - TotalExpensesMinor);
+
+	for (const TPair<FGameplayTag, int64>& Pair : IncomeTotals)
+	{
+		Summary.IncomeByCategory.Add(Pair.Key, EconomyMoney::ToFloat(Pair.Value));
+	}
+	for (const TPair<FGameplayTag, int64>& Pair : ExpenseTotals)
+	{
+		Summary.ExpensesByCategory.Add(Pair.Key, EconomyMoney::ToFloat(Pair.Value));
+	}
 
 	return Summary;
 }
 
 void UEconomySubsystem::ClearTransactionHistory()
 {
-	TransactionHistory.Empty();
+	// The current balance becomes the opening balance of the new history
+	TransactionHistory.Reset(BalanceMinor);
 	IncomeTotals.Empty();
 	ExpenseTotals.Empty();
-	TotalIncome = 0.f;
-	TotalExpenses = 0.f;
+	TotalIncomeMinor = 0;
+	TotalExpensesMinor = 0;
+	MarkSaveDirty();
 }
 
-void UEconomySubsystem::RecordTransaction(const FEconomyTransaction& Transaction)
+bool UEconomySubsystem::AuditLedger() const
 {
-	if (TransactionHistory.Num() >= MaxTransactionHistory)
+	int64 RebuiltBalance = 0;
+	FString Error;
+	if (!TransactionHistory.Verify(RebuiltBalance, Error))
 	{
-		TransactionHistory.RemoveAt(0);
+		UE_LOG(LogTemp, Error, TEXT("EconomySubsystem::AuditLedger - FAILED: %s"), *Error);
+		return false;
 	}
 
+	if (RebuiltBalance != BalanceMinor)
+	{
+		UE_LOG(LogTemp, Error, TEXT("EconomySubsystem::AuditLedger - FAILED: balance %s, rebuilt from opening %s + %d transactions = %s"),
+			*EconomyMoney::Format(BalanceMinor), *EconomyMoney::Format(TransactionHistory.GetOpeningBalance()),
+			TransactionHistory.Num(), *EconomyMoney::Format(RebuiltBalance));
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("EconomySubsystem::AuditLedger - OK: balance %s = opening %s + %d transactions"),
+		*EconomyMoney::Format(BalanceMinor), *EconomyMoney::Format(TransactionHistory.GetOpeningBalance()), TransactionHistory.Num());
+	return true;
+}
+
+void UEconomySubsystem::RecordTransaction(const FEconomyTransaction& Transaction)
+{
+	// Full ring overwrites the oldest entry - no shifting
 	TransactionHistory.Add(Transaction);
 }
 
@@ -378,10 +630,10 @@ void UEconomySubsystem::ProcessBillingCycleNow()
 	// Step 1: Clean stale consumer references
 	CleanStaleConsumers();
 
-	float TotalBilled = 0.f;
-
-	// Step 2: Poll each consumer's cost
-	const float CycleHours = BillingIntervalSeconds / 3600.f;
+	// Step 2: Poll each consumer's cost, in minor units. Sub-cent remainders carry over to the
+	// next cycle instead of being rounded away, so many small charges add up exactly over time.
+	const double CycleHours = BillingIntervalSeconds / 3600.0;
+	double ConsumerMinor = BillingCarryMinor;
 
 	for (const TWeakObjectPtr<AActor>& Weak : RegisteredConsumers)
 	{
@@ -393,33 +645,62 @@ void UEconomySubsystem::ProcessBillingCycleNow()
 
 		if (IEconomyInterface::Execute_IsConsuming(Actor))
 		{
-			const float HourlyCost = IEconomyInterface::Execute_GetCostPerHour(Actor);
-			const float CycleCost = HourlyCost * CycleHours;
+			const double HourlyCost = IEconomyInterface::Execute_GetCostPerHour(Actor);
+			const double CycleCost = HourlyCost * CycleHours;
 
-			if (CycleCost > 0.f)
+			if (CycleCost > 0.0)
 			{
-				TotalBilled += CycleCost;
+				ConsumerMinor += CycleCost * EconomyMoney::MinorUnitsPerUnit;
 			}
 		}
 	}
 
+	int64 TotalBilledMinor = 0;
+	const double WholeMinor = FMath::FloorToDouble(ConsumerMinor);
+	if (FMath::IsFinite(WholeMinor) && WholeMinor < 9.0e18)
+	{
+		TotalBilledMinor = static_cast<int64>(WholeMinor);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("EconomySubsystem::ProcessBillingCycleNow - consumer charges out of range, skipped"));
+		ConsumerMinor = 0.0;
+	}
+
+	const double NewCarry = ConsumerMinor - static_cast<double>(TotalBilledMinor);
+
 	// Step 3: Sum billing entries
 	for (const FBillingEntry& Entry : BillingEntries)
 	{
-		if (Entry.bIsActive && Entry.CostPerCycle > 0.f)
+		int64 EntryMinor = 0;
+		if (Entry.bIsActive && EconomyMoney::FromFloat(Entry.CostPerCycle, EntryMinor) && EntryMinor > 0)
 		{
-			TotalBilled += Entry.CostPerCycle;
+			if (!EconomyMoney::CheckedAdd(TotalBilledMinor, EntryMinor, TotalBilledMinor))
+			{
+				UE_LOG(LogTemp, Error, TEXT("EconomySubsystem::ProcessBillingCycleNow - billing total overflows at '%s'"), *Entry.BillingID.ToString());
+				break;
+			}
 		}
 	}
 
 	// Step 4: Deduct total (allow debt on billing cycles)
-	if (TotalBilled > 0.f)
+	if (TotalBilledMinor > 0
+		&& !ApplyTransaction(-TotalBilledMinor, FWWTagLibrary::Economy_Category_Utility(), TEXT("Billing Cycle"), nullptr))
 	{
-		DeductFunds(TotalBilled, FWWTagLibrary::Economy_Category_Utility(), TEXT("Billing Cycle"), nullptr, true);
+		// Rejected charge - keep the old carry so the fraction is billed next cycle
+		OnBillingCycleComplete.Broadcast(0.f, GetBalance());
+		return;
+	}
+
+	// Only a charge that was applied consumes the carried fraction
+	if (NewCarry != BillingCarryMinor)
+	{
+		BillingCarryMinor = NewCarry;
+		MarkSaveDirty();
 	}
 
 	// Step 5: Broadcast
-	OnBillingCycleComplete.Broadcast(TotalBilled, Balance);
+	OnBillingCycleComplete.Broadcast(EconomyMoney::ToFloat(TotalBilledMinor), GetBalance());
 }
 
 // ============================================================================
@@ -487,3 +768,118 @@ UWorld* UEconomySubsystem::GetWorldForTimers() const
 	const UGameInstance* GI = GetGameInstance();
 	return GI ? GI->GetWorld() : nullptr;
 }
+
+void UEconomySubsystem::CmdAuditEconomy(const TArray<FString>& Args, UWorld* World)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	const UGameInstance* GI = World->GetGameInstance();
+	if (!GI)
+	{
+		return;
+	}
+
+	if (const UEconomySubsystem* Sub = GI->GetSubsystem<UEconomySubsystem>())
+	{
+		const bool bPassed = Sub->AuditLedger();
+		UE_LOG(LogTemp, Log, TEXT("WW.AuditEconomy: %s (balance %s, %d transactions in history)"),
+			bPassed ? TEXT("PASSED") : TEXT("FAILED"), *EconomyMoney::Format(Sub->BalanceMinor), Sub->TransactionHistory.Num());
+	}
+}
+
+// ============================================================================
+// SAVE SYSTEM (ISaveableInterface)
+// ============================================================================
+
+void UEconomySubsystem::MarkSaveDirty()
+{
+	USaveableRegistrySubsystem::PushDirty(this, bSaveDirty);
+}
+
+FString UEconomySubsystem::GetSaveID_Implementation() const
+{
+	return EconomySubsystemPrivate::SaveID;
+}
+
+int32 UEconomySubsystem::GetSavePriority_Implementation() const
+{
+	return 10; // Early — balance is restored before gameplay systems that bill against it
+}
+
+FGameplayTag UEconomySubsystem::GetSaveType_Implementation() const
+{
+	return FWWTagLibrary::Save_Category_Subsystem();
+}
+
+bool UEconomySubsystem::SaveState_Implementation(FSaveRecord& OutRecord)
+{
+	OutRecord.RecordID = FName(EconomySubsystemPrivate::SaveID);
+	OutRecord.RecordType = FWWTagLibrary::Save_Category_Subsystem();
+	OutRecord.Priority = 10;
+	OutRecord.Timestamp = FDateTime::Now();
+	OutRecord.Version = 1;
+
+	// UPROPERTY(SaveGame) money state (all integer minor units), then the transaction history
+	TArray<uint8> BinaryData;
+	FMemoryWriter MemoryWriter(BinaryData, true);
+	FObjectAndNameAsStringProxyArchive Ar(MemoryWriter, false);
+	Ar.SetIsSaveGame(true);
+	this->Serialize(Ar);
+	TransactionHistory.Serialize(Ar);
+
+	OutRecord.BinaryData = MoveTemp(BinaryData);
+
+	UE_LOG(LogTemp, Log, TEXT("EconomySubsystem::SaveState - Saved %d bytes (Balance=%s, %d transactions)"),
+		OutRecord.BinaryData.Num(), *EconomyMoney::Format(BalanceMinor), TransactionHistory.Num());
+
+	return OutRecord.BinaryData.Num() > 0;
+}
+
+bool UEconomySubsystem::LoadState_Implementation(const FSaveRecord& InRecord)
+{
+	if (InRecord.BinaryData.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("EconomySubsystem::LoadState - Empty binary data"));
+		return false;
+	}
+
+	TArray<uint8> BinaryData = InRecord.BinaryData; // Copy for non-const reader
+	FMemoryReader MemoryReader(BinaryData, true);
+	FObjectAndNameAsStringProxyArchive Ar(MemoryReader, false);
+	Ar.SetIsSaveGame(true);
+	this->Serialize(Ar);
+	TransactionHistory.Serialize(Ar);
+
+	if (Ar.IsError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("EconomySubsystem::LoadState - Corrupt economy record"));
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("EconomySubsystem::LoadState - Loaded %d bytes (Balance=%s, %d transactions)"),
+		InRecord.BinaryData.Num(), *EconomyMoney::Format(BalanceMinor), TransactionHistory.Num());
+
+	OnSaveDataLoaded_Implementation();
+	return true;
+}
+
+bool UEconomySubsystem::IsDirty_Implementation() const
+{
+	return bSaveDirty;
+}
+
+void UEconomySubsystem::ClearDirty_Implementation()
+{
+	bSaveDirty = false;
+}
+
+void UEconomySubsystem::OnSaveDataLoaded_Implementation()
+{
+	// A loaded ledger must reconcile exactly - a mismatch means the save diverged from what was written
+	AuditLedger();
+
+	OnBalanceChanged.Broadcast(GetBalance(), 0.f);
+}
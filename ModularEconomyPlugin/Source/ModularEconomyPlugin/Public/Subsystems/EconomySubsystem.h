@@ -5,10 +5,127 @@
 #include "CoreMinimal.h"
 #include "Delegates/ModularEconomyPlugin/EconomyDelegates.h"
 #include "Lib/Data/ModularEconomyPlugin/EconomyData.h"
+#include "Interfaces/ModularSaveGameSystem/SaveableInterface.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "GameplayTagContainer.h"
 #include "EconomySubsystem.generated.h"
 
+/**
+ * Money is held as int64 currency minor units (cents): sums are exact and identical on every
+ * machine. Floats only appear at the Blueprint/UI edge and are rounded to the nearest cent there.
+ */
+namespace EconomyMoney
+{
+	static constexpr int64 MinorUnitsPerUnit = 100;
+
+	/** Nearest minor unit (halves away from zero). @return false if not finite or out of int64 range */
+	inline bool FromFloat(double Amount, int64& OutMinor)
+	{
+		const double Scaled = FMath::RoundHalfFromZero(Amount * MinorUnitsPerUnit);
+		if (!FMath::IsFinite(Scaled) || FMath::Abs(Scaled) >= 9.0e18)
+		{
+			return false;
+		}
+		OutMinor = static_cast<int64>(Scaled);
+		return true;
+	}
+
+	inline float ToFloat(int64 Minor)
+	{
+		return static_cast<float>(static_cast<double>(Minor) / MinorUnitsPerUnit);
+	}
+
+	/** @return false (Out untouched) on overflow */
+	inline bool CheckedAdd(int64 A, int64 B, int64& Out)
+	{
+		if ((B > 0 && A > MAX_int64 - B) || (B < 0 && A < MIN_int64 - B))
+		{
+			return false;
+		}
+		Out = A + B;
+		return true;
+	}
+
+	/** "-1234.56" */
+	inline FString Format(int64 Minor)
+	{
+		const uint64 Magnitude = Minor < 0 ? static_cast<uint64>(-(Minor + 1)) + 1 : static_cast<uint64>(Minor);
+		return FString::Printf(TEXT("%s%llu.%02llu"), Minor < 0 ? TEXT("-") : TEXT(""),
+			Magnitude / MinorUnitsPerUnit, Magnitude % MinorUnitsPerUnit);
+	}
+}
+
+/**
+ * Fixed-capacity transaction history (ring buffer).
+ * Appending evicts the oldest entry in O(1). Each category keeps a FIFO of its entries'
+ * sequence numbers and a rolling total over the entries still in the window, both
+ * updated on append/evict, so category queries touch only that category's entries.
+ */
+class MODULARECONOMYPLUGIN_API FTransactionLedger
+{
+public:
+	explicit FTransactionLedger(int32 InCapacity);
+
+	void Add(const FEconomyTransaction& Transaction);
+
+	/** Empty the window. OpeningBalance is the balance before the next entry. */
+	void Reset(int64 OpeningBalance = 0);
+
+	int32 Num() const { return Count; }
+	int32 GetCapacity() const { return Slots.Num(); }
+
+	/** Up to MaxCount entries, most recent first */
+	void GetRecent(int32 MaxCount, TArray<FEconomyTransaction>& OutTransactions) const;
+
+	/** Entries with exactly this category, oldest first */
+	void GetByCategory(const FGameplayTag& Category, TArray<FEconomyTransaction>& OutTransactions) const;
+
+	/** Net amount (minor units) of the category's entries still in the window */
+	int64 GetCategoryTotal(const FGameplayTag& Category) const;
+
+	/** Balance before the oldest entry in the window - evicted entries are folded into it */
+	int64 GetOpeningBalance() const { return OpeningBalance; }
+
+	/** Balance changes that are not transactions (admin set) */
+	void AdjustOpeningBalance(int64 Delta) { OpeningBalance += Delta; }
+
+	/**
+	 * Re-add every entry from the opening balance and recount the category windows.
+	 * @param OutClosingBalance - Opening balance plus every entry in the window
+	 * @return false (with OutError) if the recount disagrees with the incremental state or overflows
+	 */
+	bool Verify(int64& OutClosingBalance, FString& OutError) const;
+
+	/** Opening balance + entries oldest first (source actors are not saved) */
+	void Serialize(FArchive& Ar);
+
+private:
+	struct FCategoryWindow
+	{
+		/** Sequence numbers, oldest first from Head */
+		TArray<uint64> Sequences;
+		int32 Head = 0;
+		int64 Total = 0;
+
+		int32 Num() const { return Sequences.Num() - Head; }
+	};
+
+	const FEconomyTransaction& GetBySequence(uint64 Sequence) const { return Slots[Sequence % Slots.Num()]; }
+
+	/** Drop the oldest entry from its category window */
+	void EvictOldest();
+
+	TArray<FEconomyTransaction> Slots;
+	int32 Count = 0;
+
+	/** Sequence of the next entry; the oldest live entry is NextSequence - Count */
+	uint64 NextSequence = 0;
+
+	int64 OpeningBalance = 0;
+
+	TMap<FGameplayTag, FCategoryWindow> Categories;
+};
+
 /**
  * Economy Subsystem
  *
@@ -19,9 +136,10 @@
  * - Configurable billing cycle that auto-deducts costs
  *
  * Uses FTimerHandle for billing (no tick). Polls consumers each cycle.
+ * Amounts are kept in integer minor units (see EconomyMoney); the float API rounds to cents.
  */
 UCLASS()
-class MODULARECONOMYPLUGIN_API UEconomySubsystem : public UGameInstanceSubsystem
+class MODULARECONOMYPLUGIN_API UEconomySubsystem : public UGameInstanceSubsystem, public ISaveableInterface
 {
 	GENERATED_BODY()
 
@@ -77,7 +195,11 @@ public:
 
 	/** Get current balance */
 	UFUNCTION(BlueprintPure, Category = "Economy|Balance")
-	float GetBalance() const { return Balance; }
+	float GetBalance() const { return EconomyMoney::ToFloat(BalanceMinor); }
+
+	/** Exact balance in currency minor units (cents) - use for server reconciliation */
+	UFUNCTION(BlueprintPure, Category = "Economy|Balance")
+	int64 GetBalanceMinorUnits() const { return BalanceMinor; }
 
 	/** Add funds (income). Returns new balance. */
 	UFUNCTION(BlueprintCallable, Category = "Economy|Balance")
@@ -89,7 +211,7 @@ public:
 
 	/** Check if player can afford a given amount */
 	UFUNCTION(BlueprintPure, Category = "Economy|Balance")
-	bool CanAfford(float Amount) const { return Balance >= Amount; }
+	bool CanAfford(float Amount) const;
 
 	/** Force-set balance (admin/cheat). Broadcasts OnBalanceChanged. */
 	UFUNCTION(BlueprintCallable, Category = "Economy|Balance")
@@ -107,6 +229,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Economy|History")
 	TArray<FEconomyTransaction> GetTransactionsByCategory(FGameplayTag Category) const;
 
+	/** Net amount of the category's transactions still in history (rolling window) */
+	UFUNCTION(BlueprintPure, Category = "Economy|History")
+	float GetHistoryTotalByCategory(FGameplayTag Category) const;
+
 	/** Get financial summary snapshot for UI */
 	UFUNCTION(BlueprintPure, Category = "Economy|History")
 	FFinancialSummary GetFinancialSummary() const;
@@ -115,6 +241,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Economy|History")
 	void ClearTransactionHistory();
 
+	/**
+	 * Rebuild the balance from the opening balance and the transaction history and check it
+	 * matches the live balance exactly (and that the per-category windows add up). Logs the result.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Economy|History")
+	bool AuditLedger() const;
+
+	/** Console command: WW.AuditEconomy */
+	static void CmdAuditEconomy(const TArray<FString>& Args, UWorld* World);
+
 	// ============================================================================
 	// RESOURCE CONSUMER REGISTRATION
 	// ============================================================================
@@ -192,26 +328,35 @@ private:
 	// INTERNAL STATE
 	// ============================================================================
 
-	/** Current balance */
-	float Balance = 0.f;
-
-	/** Transaction history (circular buffer, max 200) */
-	TArray<FEconomyTransaction> TransactionHistory;
+	/** Current balance (minor units) */
+	UPROPERTY(SaveGame)
+	int64 BalanceMinor = 0;
 
 	/** Maximum transactions to keep in history */
 	static constexpr int32 MaxTransactionHistory = 200;
 
-	/** Running income totals by category */
-	TMap<FGameplayTag, float> IncomeTotals;
+	/** Transaction history (circular buffer, max 200) - saved after the SaveGame properties */
+	FTransactionLedger TransactionHistory{ MaxTransactionHistory };
+
+	/** Running income totals by category (minor units) */
+	UPROPERTY(SaveGame)
+	TMap<FGameplayTag, int64> IncomeTotals;
+
+	/** Running expense totals by category (minor units) */
+	UPROPERTY(SaveGame)
+	TMap<FGameplayTag, int64> ExpenseTotals;
 
-	/** Running expense totals by category */
-	TMap<FGameplayTag, float> ExpenseTotals;
+	/** Total income since last clear (minor units) */
+	UPROPERTY(SaveGame)
+	int64 TotalIncomeMinor = 0;
 
-	/** Total income since last clear */
-	float TotalIncome = 0.f;
+	/** Total expenses since last clear (minor units) */
+	UPROPERTY(SaveGame)
+	int64 TotalExpensesMinor = 0;
 
-	/** Total expenses since last clear */
-	float TotalExpenses = 0.f;
+	/** Sub-cent consumer charges not billed yet, carried into the next cycle (minor units, < 1) */
+	UPROPERTY(SaveGame)
+	double BillingCarryMinor = 0.0;
 
 	/** Registered resource consumers */
 	TArray<TWeakObjectPtr<AActor>> RegisteredConsumers;
@@ -235,9 +380,32 @@ private:
 	/** Record a transaction to history (capped at MaxTransactionHistory) */
 	void RecordTransaction(const FEconomyTransaction& Transaction);
 
+	/** Apply a signed amount: overflow-checked balance/totals update, history, broadcasts. @return false if rejected */
+	bool ApplyTransaction(int64 AmountMinor, const FGameplayTag& Category, const FString& Description, AActor* Source);
+
 	/** Clean up stale (destroyed) consumer references */
 	void CleanStaleConsumers();
 
 	/** Get the world for timer access */
 	UWorld* GetWorldForTimers() const;
+
+	// ============================================================================
+	// SAVE SYSTEM (ISaveableInterface)
+	// ============================================================================
+
+	/** Dirty flag for save system (Rule #40) */
+	bool bSaveDirty = false;
+
+	/** Mark this subsystem as having unsaved changes */
+	void MarkSaveDirty();
+
+	// ISaveableInterface _Implementation methods
+	virtual FString GetSaveID_Implementation() const override;
+	virtual int32 GetSavePriority_Implementation() const override;
+	virtual FGameplayTag GetSaveType_Implementation() const override;
+	virtual bool SaveState_Implementation(FSaveRecord& OutRecord) override;
+	virtual bool LoadState_Implementation(const FSaveRecord& InRecord) override;
+	virtual bool IsDirty_Implementation() const override;
+	virtual void ClearDirty_Implementation() override;
+	virtual void OnSaveDataLoaded_Implementation() override;
 };
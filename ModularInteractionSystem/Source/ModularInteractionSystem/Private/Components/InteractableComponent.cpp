@@ -37,7 +37,7 @@
 
 UInteractableComponent::UInteractableComponent()
 {
-    PrimaryComponentTick.bCanEverTick = false;  // Will be enabled only if movement tracking needed
+    PrimaryComponentTick.bCanEverTick = false;  // Movement tracking runs in the subsystem's batched mover pass
     
     // 🔥 SIMPLEST CONSTRUCTOR: Set ONLY raw defaults. Remove ALL tag assignments.
     InteractableTypeTag = FGameplayTag::RequestGameplayTag(FName("Interactable"));
@@ -56,7 +56,6 @@ UInteractableComponent::UInteractableComponent()
     // SPATIAL HASH MOVEMENT TRACKING - NEW
     // ========================================================================
     LastKnownLocation = FVector::ZeroVector;
-    MovementCheckTimeAccumulator = 0.f;
 }
 
 // ============================================================================
@@ -77,6 +76,33 @@ void UInteractableComponent::PostInitProperties()
    }
 }
 
+void UInteractableComponent::PostLoad()
+{
+   Super::PostLoad();
+
+   // Assets saved before the batched mover pass may carry their own check interval
+   if (MovementCheckInterval_DEPRECATED >= 0.f)
+   {
+      MovementUpdateInterval = MovementCheckInterval_DEPRECATED;
+      MovementCheckInterval_DEPRECATED = -1.f;
+   }
+}
+
+#if WITH_EDITOR
+void UInteractableComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+   Super::PostEditChangeProperty(PropertyChangedEvent);
+
+   const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+   if (PropertyName == GET_MEMBER_NAME_CHECKED(UInteractableComponent, bTrackMovementForSpatialHash)
+      || PropertyName == GET_MEMBER_NAME_CHECKED(UInteractableComponent, MovementThreshold)
+      || PropertyName == GET_MEMBER_NAME_CHECKED(UInteractableComponent, MovementUpdateInterval))
+   {
+      RefreshMovementTracking();
+   }
+}
+#endif
+
 
 void UInteractableComponent::BeginPlay()
 {
@@ -181,26 +207,24 @@ void UInteractableComponent::BeginPlay()
    {
       LastKnownLocation = Owner->GetActorLocation();
       
-      // Register actor with spatial hash grid
-      if (UWorld* World = GetWorld())
-      {
-         if (UInteractionSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UInteractionSubsystem>())
-         {
-            Subsystem->RegisterInteractable(Owner);
-         }
-      }
-      
       // Auto-detect movement if not manually configured
       if (!bTrackMovementForSpatialHash)
       {
          AutoDetectMovement();
       }
       
-      // Enable tick only if movement tracking is needed
-      if (bTrackMovementForSpatialHash)
+      // Register actor with spatial hash grid; movers join the subsystem's batched pass instead of ticking
+      if (UWorld* World = GetWorld())
       {
-         PrimaryComponentTick.bCanEverTick = true;
-         SetComponentTickEnabled(true);
+         if (UInteractionSubsystem* Subsystem = World->GetGameInstance()->GetSubsystem<UInteractionSubsystem>())
+         {
+            Subsystem->RegisterInteractable(Owner);
+            
+            if (bTrackMovementForSpatialHash)
+            {
+               Subsystem->RegisterMovingInteractable(Owner, MovementThreshold, MovementUpdateInterval);
+            }
+         }
       }
    }
 
@@ -263,7 +287,7 @@ void UInteractableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
         Registry->UnregisterSaveable(GetSaveID_Implementation());
     }
 
-    // Unregister from spatial hash grid
+    // Unregister from spatial hash grid (also drops the owner from the batched mover pass)
     if (AActor* Owner = GetOwner())
     {
        if (UWorld* World = GetWorld())
@@ -285,58 +309,10 @@ void UInteractableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
     Super::EndPlay(EndPlayReason);
 }
 
-// ============================================================================
-// TICK COMPONENT - NEW (ONLY FOR MOVEMENT TRACKING)
-// ============================================================================
-
-void UInteractableComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	
-	// Only tick if movement tracking is enabled
-	if (!bTrackMovementForSpatialHash)
-		return;
-	
-	// Rate limit movement checks
-	MovementCheckTimeAccumulator += DeltaTime;
-	if (MovementCheckTimeAccumulator < MovementCheckInterval)
-		return;
-	
-	MovementCheckTimeAccumulator = 0.f;
-	
-	// Check if actor moved significantly
-	UpdateSpatialGridPosition();
-}
-
 // ============================================================================
 // SPATIAL HASH MOVEMENT TRACKING IMPLEMENTATIONS - NEW
 // ============================================================================
 
-void UInteractableComponent::UpdateSpatialGridPosition()
-{
-	AActor* Owner = GetOwner();
-	if (!Owner)
-		return;
-	
-	FVector CurrentLocation = Owner->GetActorLocation();
-	float DistanceMoved = FVector::Dist(LastKnownLocation, CurrentLocation);
-	
-	// Check if moved beyond threshold
-	if (DistanceMoved >= MovementThreshold)
-	{
-		// Notify spatial grid of position change
-		if (UInteractionSubsystem* System = UInteractionSubsystem::Get(Owner->GetWorld()))
-		{
-			System->NotifyActorMoved(Owner, LastKnownLocation);
-			
-
-		}
-		
-		// Update last known location
-		LastKnownLocation = CurrentLocation;
-	}
-}
-
 void UInteractableComponent::AutoDetectMovement()
 {
 	AActor* Owner = GetOwner();
@@ -388,6 +364,32 @@ bool UInteractableComponent::HasMovementComponents() const
 	return false;
 }
 
+void UInteractableComponent::SetTrackMovementForSpatialHash(bool bEnable)
+{
+	if (bTrackMovementForSpatialHash == bEnable)
+		return;
+	
+	bTrackMovementForSpatialHash = bEnable;
+	RefreshMovementTracking();
+}
+
+void UInteractableComponent::RefreshMovementTracking()
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !HasBegunPlay())
+		return;
+	
+	if (UInteractionSubsystem* System = UInteractionSubsystem::Get(Owner->GetWorld()))
+	{
+		// Re-adding picks up a changed threshold or interval too
+		System->UnregisterMovingInteractable(Owner);
+		if (bTrackMovementForSpatialHash)
+		{
+			System->RegisterMovingInteractable(Owner, MovementThreshold, MovementUpdateInterval);
+		}
+	}
+}
+
 void UInteractableComponent::ForceUpdateSpatialGrid()
 {
 	AActor* Owner = GetOwner();
@@ -892,5 +894,5 @@ void UInteractableComponent::OnSaveDataLoaded_Implementation()
 
 void UInteractableComponent::MarkSaveDirty()
 {
-	bSaveDirty = true;
+	USaveableRegistrySubsystem::PushDirty(this, bSaveDirty);
 }
@@ -0,0 +1,122 @@
+// InteractionStats.cpp
+// Stat definitions and rolling timing histograms for the interaction subsystem
+
+#include "InteractionStats.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_STAT(STAT_Interaction_GridQuery);
+DEFINE_STAT(STAT_Interaction_LaunchBatchTraces);
+DEFINE_STAT(STAT_Interaction_OnBatchedTraceComplete);
+DEFINE_STAT(STAT_Interaction_LaunchBatchValidation);
+DEFINE_STAT(STAT_Interaction_TickStaggeredAITraces);
+
+DEFINE_STAT(STAT_Interaction_NumGridQueries);
+DEFINE_STAT(STAT_Interaction_NumGridQueryResults);
+DEFINE_STAT(STAT_Interaction_NumBatchTraces);
+DEFINE_STAT(STAT_Interaction_NumValidations);
+DEFINE_STAT(STAT_Interaction_NumAITraces);
+
+#if !UE_BUILD_SHIPPING
+
+namespace InteractionTimings
+{
+    // Samples kept per slot (power of two so the ring index is a mask)
+    constexpr int32 SampleCapacity = 1024;
+
+    struct FTimingRing
+    {
+        double Samples[SampleCapacity];
+        int32 NextIndex = 0;
+        int32 NumSamples = 0;
+    };
+
+    static FTimingRing Rings[static_cast<int32>(EInteractionTimingSlot::Count)];
+
+    static const TCHAR* GetSlotName(EInteractionTimingSlot Slot)
+    {
+        switch (Slot)
+        {
+        case EInteractionTimingSlot::GridQuery:              return TEXT("GridQuery");
+        case EInteractionTimingSlot::LaunchBatchTraces:      return TEXT("LaunchBatchTraces");
+        case EInteractionTimingSlot::OnBatchedTraceComplete: return TEXT("OnBatchedTraceComplete");
+        case EInteractionTimingSlot::LaunchBatchValidation:  return TEXT("LaunchBatchValidation");
+        case EInteractionTimingSlot::TickStaggeredAITraces:  return TEXT("TickStaggeredAITraces");
+        default:                                             return TEXT("Unknown");
+        }
+    }
+
+    void Record(EInteractionTimingSlot Slot, double DurationMs)
+    {
+        // Rings are unsynchronised - worker-thread callers are simply not sampled
+        if (!IsInGameThread())
+            return;
+
+        FTimingRing& Ring = Rings[static_cast<int32>(Slot)];
+        Ring.Samples[Ring.NextIndex] = DurationMs;
+        Ring.NextIndex = (Ring.NextIndex + 1) & (SampleCapacity - 1);
+        Ring.NumSamples = FMath::Min(Ring.NumSamples + 1, SampleCapacity);
+    }
+
+    void PrintTimings()
+    {
+        UE_LOG(LogTemp, Warning, TEXT("=== Interaction Timings (last %d samples per path) ==="), SampleCapacity);
+        UE_LOG(LogTemp, Warning, TEXT("%-24s %8s %10s %10s %10s %10s"), TEXT("Path"), TEXT("Samples"), TEXT("Min ms"), TEXT("Avg ms"), TEXT("P99 ms"), TEXT("Max ms"));
+
+        TArray<double> Sorted;
+        Sorted.Reserve(SampleCapacity);
+
+        for (int32 SlotIndex = 0; SlotIndex < static_cast<int32>(EInteractionTimingSlot::Count); SlotIndex++)
+        {
+            const FTimingRing& Ring = Rings[SlotIndex];
+            const TCHAR* SlotName = GetSlotName(static_cast<EInteractionTimingSlot>(SlotIndex));
+
+            if (Ring.NumSamples == 0)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("%-24s %8d %10s %10s %10s %10s"), SlotName, 0, TEXT("-"), TEXT("-"), TEXT("-"), TEXT("-"));
+                continue;
+            }
+
+            Sorted.Reset();
+            Sorted.Append(Ring.Samples, Ring.NumSamples);
+            Sorted.Sort();
+
+            double Sum = 0.0;
+            for (double Sample : Sorted)
+            {
+                Sum += Sample;
+            }
+
+            const int32 P99Index = FMath::Clamp(FMath::CeilToInt(Sorted.Num() * 0.99) - 1, 0, Sorted.Num() - 1);
+
+            UE_LOG(LogTemp, Warning, TEXT("%-24s %8d %10.4f %10.4f %10.4f %10.4f"),
+                SlotName, Ring.NumSamples, Sorted[0], Sum / Sorted.Num(), Sorted[P99Index], Sorted.Last());
+        }
+
+        UE_LOG(LogTemp, Warning, TEXT("=========================="));
+    }
+
+    void ResetTimings()
+    {
+        for (FTimingRing& Ring : Rings)
+        {
+            Ring.NextIndex = 0;
+            Ring.NumSamples = 0;
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("Interaction timings reset"));
+    }
+}
+
+static FAutoConsoleCommand GPrintInteractionTimingsCmd(
+    TEXT("PrintInteractionTimings"),
+    TEXT("Print rolling min/avg/p99 timings for interaction hot paths"),
+    FConsoleCommandDelegate::CreateStatic(&InteractionTimings::PrintTimings)
+);
+
+static FAutoConsoleCommand GResetInteractionTimingsCmd(
+    TEXT("ResetInteractionTimings"),
+    TEXT("Clear the interaction timing histograms"),
+    FConsoleCommandDelegate::CreateStatic(&InteractionTimings::ResetTimings)
+);
+
+#endif // !UE_BUILD_SHIPPING
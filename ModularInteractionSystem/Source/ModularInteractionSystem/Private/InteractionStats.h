@@ -0,0 +1,88 @@
+// InteractionStats.h
+// Stat group, cycle counters and rolling timing histograms for the interaction subsystem
+//
+// Two layers, both free in Shipping:
+// - STAT counters / cycle scopes ("stat Interaction") - compiled out when STATS == 0
+// - Rolling min/avg/p99 histograms per hot path ("PrintInteractionTimings") - compiled out in Shipping
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("Interaction"), STATGROUP_Interaction, STATCAT_Advanced);
+
+// Cycle scopes
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Grid Query"), STAT_Interaction_GridQuery, STATGROUP_Interaction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LaunchBatchTraces"), STAT_Interaction_LaunchBatchTraces, STATGROUP_Interaction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnBatchedTraceComplete"), STAT_Interaction_OnBatchedTraceComplete, STATGROUP_Interaction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LaunchBatchValidation"), STAT_Interaction_LaunchBatchValidation, STATGROUP_Interaction, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("TickStaggeredAITraces"), STAT_Interaction_TickStaggeredAITraces, STATGROUP_Interaction, );
+
+// Per-frame counters
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Grid Queries"), STAT_Interaction_NumGridQueries, STATGROUP_Interaction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Grid Query Results"), STAT_Interaction_NumGridQueryResults, STATGROUP_Interaction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batch Traces Launched"), STAT_Interaction_NumBatchTraces, STATGROUP_Interaction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Validations Launched"), STAT_Interaction_NumValidations, STATGROUP_Interaction, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Traces Launched"), STAT_Interaction_NumAITraces, STATGROUP_Interaction, );
+
+#if !UE_BUILD_SHIPPING
+
+/** Hot paths tracked by the rolling histograms */
+enum class EInteractionTimingSlot : uint8
+{
+    GridQuery,
+    LaunchBatchTraces,
+    OnBatchedTraceComplete,
+    LaunchBatchValidation,
+    TickStaggeredAITraces,
+
+    Count
+};
+
+/**
+ * Rolling timing histograms (game thread only)
+ * Each slot keeps the last SampleCapacity durations in a ring buffer;
+ * min/avg/p99 are computed on demand when printed, so recording is just a store.
+ */
+namespace InteractionTimings
+{
+    /** Record one sample in milliseconds (ignored off the game thread) */
+    void Record(EInteractionTimingSlot Slot, double DurationMs);
+
+    /** Print min/avg/p99 for every slot */
+    void PrintTimings();
+
+    /** Drop all recorded samples */
+    void ResetTimings();
+}
+
+/** RAII scope feeding one histogram slot */
+class FInteractionTimingScope
+{
+public:
+    explicit FInteractionTimingScope(EInteractionTimingSlot InSlot)
+        : Slot(InSlot)
+        , StartCycles(FPlatformTime::Cycles64())
+    {
+    }
+
+    ~FInteractionTimingScope()
+    {
+        InteractionTimings::Record(Slot, FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+    }
+
+private:
+    EInteractionTimingSlot Slot;
+    uint64 StartCycles;
+};
+
+#define INTERACTION_SCOPE_TIMING(Slot, StatId) \
+    SCOPE_CYCLE_COUNTER(StatId); \
+    FInteractionTimingScope ANONYMOUS_VARIABLE(InteractionTimingScope_)(EInteractionTimingSlot::Slot)
+
+#else
+
+#define INTERACTION_SCOPE_TIMING(Slot, StatId) SCOPE_CYCLE_COUNTER(StatId)
+
+#endif // !UE_BUILD_SHIPPING
@@ -1,5 +1,6 @@
 // InteractionSubsystem.cpp
 #include "InteractionSubsystem.h"
+#include "InteractionStats.h"
 
 #include "GameFramework/PlayerController.h"
 #include "Engine/World.h"
@@ -30,9 +31,9 @@ void UInteractionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	// ========================================================================
 	if (bUseSpatialHashing)
 	{
-		SpatialGrid = MakeUnique<FSpatialHashGrid>(SpatialGridCellSize);
-		UE_LOG(LogInteractableSubsystem, Log, TEXT("🗺️ Spatial Hash Grid initialized (Cell Size: %.1f, Query Radius: %d cells)"), 
-			SpatialGridCellSize, SpatialQueryCellRadius);
+		SpatialGrid = MakeUnique<FSpatialHashGrid>(SpatialGridCellSize, SpatialGridCellHeight);
+		UE_LOG(LogInteractableSubsystem, Log, TEXT("🗺️ Spatial Hash Grid initialized (Cell Size: %.1f, Cell Height: %.1f, Query Radius: %d cells)"), 
+			SpatialGridCellSize, SpatialGridCellHeight, SpatialQueryCellRadius);
 		
 		// Register console commands for spatial hash debugging
 		FSpatialHashGrid::RegisterConsoleCommands(this);
@@ -73,6 +74,10 @@ void UInteractionSubsystem::Deinitialize()
 {
 	// ✅ STOP AI UPDATE TIMER
 	StopAIUpdateTimer();
+	
+	// Invalidate any AI priority job still running on the thread pool
+	++AIPriorityJobGeneration;
+	bAIPriorityJobInFlight = false;
 
 	// Cleanup all active traces
 	ActivePlayerTraces.Empty();
@@ -80,6 +85,14 @@ void UInteractionSubsystem::Deinitialize()
 	PendingValidations.Empty();
 	RegisteredAIPawns.Empty();
 	FocusedActors.Empty();
+	TrackedMovers.Empty();
+	TrackedMoverKeys.Empty();
+	TrackedMoverLastLocations.Empty();
+	TrackedMoverThresholdsSq.Empty();
+	TrackedMoverIntervals.Empty();
+	TrackedMoverElapsed.Empty();
+	ShortestTrackedMoverInterval = MAX_flt;
+	TrackedMoverIndices.Empty();
 	
 	// ========================================================================
 	// SPATIAL HASH GRID CLEANUP - NEW
@@ -119,6 +132,9 @@ void UInteractionSubsystem::Tick(float DeltaTime)
     
 	// AI staggered updates
 	TickStaggeredAITraces(DeltaTime);
+	
+	// Batched spatial grid update for moving interactables
+	TickMovingInteractables(DeltaTime);
     
 	// NEW: Automatic player focus updates
 	if (bAutoUpdatePlayerFocus)
@@ -209,7 +225,10 @@ void UInteractionSubsystem::RegisterInteractable(AActor* Actor)
 void UInteractionSubsystem::UnregisterInteractable(AActor* Actor)
 {
     if (Actor)
+    {
         Interactables.Remove(Actor);
+        UnregisterMovingInteractable(Actor);
+    }
     
     // ========================================================================
     // SPATIAL HASH GRID UNREGISTRATION - NEW
@@ -321,8 +340,16 @@ void UInteractionSubsystem::UpdateNearbyItemPrioritiesAsync()
 		UpdateNearbyItemPriorities(0.5f);
 		return;
 	}
-		// ========================================================================
-	// STEP 1: Collect all AI data on GAME THREAD (fast - just copying data)
+	
+	// Previous job still running - its results are at most one interval old, skip this tick
+	if (bAIPriorityJobInFlight)
+	{
+		UE_LOG(LogInteractableSubsystem, VeryVerbose, TEXT("⏭️ AI priority job still in flight, skipping tick"));
+		return;
+	}
+	
+	// ========================================================================
+	// STEP 1: Snapshot everything the job needs on the GAME THREAD
 	// ========================================================================
 	
 	TArray<FAIPriorityData> AIDataBatch;
@@ -334,27 +361,25 @@ void UInteractionSubsystem::UpdateNearbyItemPrioritiesAsync()
 		if (!Pawn)
 			continue;
 		
-		// Copy pawn data and item list
-		FAIPriorityData Data;
+		FAIPriorityData& Data = AIDataBatch.AddDefaulted_GetRef();
 		Data.Pawn = Pawn;
 		Data.PawnLocation = Pawn->GetActorLocation();
 		
-		// Copy items with their current data
-		TArray<FNearbyItemInfo>& Items = Pair.Value;
-		Data.ItemsWithDistances.Reserve(Items.Num());
+		// Positions and tag priorities are read here, never on the worker
+		const TArray<FNearbyItemInfo>& Items = Pair.Value;
+		Data.Items.Reserve(Items.Num());
 		
 		for (const FNearbyItemInfo& Info : Items)
 		{
-			if (Info.Item.IsValid())
+			if (AActor* Item = Info.Item.Get())
 			{
-				Data.ItemsWithDistances.Add(TPair<TWeakObjectPtr<AActor>, float>(
-					Info.Item,
-					Info.DistanceSquared
-				));
+				FAIPriorityItemSnapshot& Snapshot = Data.Items.AddDefaulted_GetRef();
+				Snapshot.Item = Info.Item;
+				Snapshot.Location = Item->GetActorLocation();
+				Snapshot.TagPriority = GetGameplayTagPriority(Item, true);
+				Snapshot.DistanceSquared = Info.DistanceSquared;
 			}
 		}
-		
-		AIDataBatch.Add(Data);
 	}
 	
 	// If no AI to process, return early
@@ -366,63 +391,70 @@ void UInteractionSubsystem::UpdateNearbyItemPrioritiesAsync()
 	UE_LOG(LogInteractableSubsystem, Log, TEXT("🤖 Starting async AI priority calculations for %d pawns"), AIDataBatch.Num());
 	
 	// ========================================================================
-	// STEP 2: Launch BACKGROUND THREAD for heavy calculations
+	// STEP 2: Score the snapshot on a BACKGROUND THREAD
 	// ========================================================================
 	
-	Async(EAsyncExecution::ThreadPool, [AIDataBatch, this]() mutable
+	bAIPriorityJobInFlight = true;
+	
+	const uint32 JobGeneration = AIPriorityJobGeneration;
+	TWeakObjectPtr<UInteractionSubsystem> WeakThis(this);
+	TWeakObjectPtr<UWorld> JobWorld(GetWorld());
+	
+	Async(EAsyncExecution::ThreadPool, [AIDataBatch = MoveTemp(AIDataBatch), WeakThis, JobWorld, JobGeneration]() mutable
 	{
-		// 🧵 NOW ON BACKGROUND THREAD - Heavy math here!
-		
-		// Process each AI pawn
+		// 🧵 BACKGROUND THREAD - only the snapshot is touched here
 		for (FAIPriorityData& Data : AIDataBatch)
 		{
-			if (!Data.Pawn.IsValid())
-				continue;
-			
-			// ========================================
-			// HEAVY CALCULATIONS (off main thread!)
-			// ========================================
-			
-			// Recalculate all distances
-			for (auto& ItemPair : Data.ItemsWithDistances)
-			{
-				if (ItemPair.Key.IsValid())
-				{
-					// Calculate distance squared
-					AActor* Item = ItemPair.Key.Get();
-					ItemPair.Value = FVector::DistSquared(
-						Data.PawnLocation,
-						Item->GetActorLocation()
-					);
-				}
-			}
-			
-			// Sort by distance (closest first)
-			Data.ItemsWithDistances.Sort([](const TPair<TWeakObjectPtr<AActor>, float>& A, 
-											 const TPair<TWeakObjectPtr<AActor>, float>& B)
-			{
-				return A.Value < B.Value; // Ascending order (closest = lowest distance)
-			});
+			ScoreAIPrioritySnapshot(Data);
 		}
 		
 		// ========================================================================
-		// STEP 3: Switch back to GAME THREAD to apply results
+		// STEP 3: Publish back on the GAME THREAD (dropped if stale)
 		// ========================================================================
 		
-		AsyncTask(ENamedThreads::GameThread, [this, AIDataBatch]()
+		AsyncTask(ENamedThreads::GameThread, [AIDataBatch = MoveTemp(AIDataBatch), WeakThis, JobWorld, JobGeneration]() mutable
 		{
-			// 🎮 BACK ON GAME THREAD - Safe to modify UObjects!
+			UInteractionSubsystem* Subsystem = WeakThis.Get();
+			if (!Subsystem || JobGeneration != Subsystem->AIPriorityJobGeneration)
+			{
+				UE_LOG(LogInteractableSubsystem, Verbose, TEXT("🗑️ Dropping stale AI priority job (generation %u)"), JobGeneration);
+				return;
+			}
+			
+			Subsystem->bAIPriorityJobInFlight = false;
+			
+			// World changed under the job (level travel) - snapshot refers to the old world
+			if (!JobWorld.IsValid() || JobWorld.Get() != Subsystem->GetWorld())
+			{
+				UE_LOG(LogInteractableSubsystem, Verbose, TEXT("🗑️ Dropping AI priority job from a previous world"));
+				return;
+			}
 			
 			UE_LOG(LogInteractableSubsystem, VeryVerbose, TEXT("✅ AI priority calculations complete, applying results"));
 			
-			// Apply calculated priorities to each AI
-			OnAIPriorityCalculationsComplete(AIDataBatch);
+			Subsystem->OnAIPriorityCalculationsComplete(MoveTemp(AIDataBatch));
 		});
 	});
 	
 	// Function returns IMMEDIATELY - no blocking! ✅
 }
 
+void UInteractionSubsystem::ScoreAIPrioritySnapshot(FAIPriorityData& Data)
+{
+	for (FAIPriorityItemSnapshot& Item : Data.Items)
+	{
+		Item.DistanceSquared = FVector::DistSquared(Data.PawnLocation, Item.Location);
+	}
+	
+	// Closest first; higher tag priority breaks distance ties
+	Data.Items.Sort([](const FAIPriorityItemSnapshot& A, const FAIPriorityItemSnapshot& B)
+	{
+		if (A.DistanceSquared != B.DistanceSquared)
+			return A.DistanceSquared < B.DistanceSquared;
+		return A.TagPriority > B.TagPriority;
+	});
+}
+
 
 // Runs on GAME THREAD after background calculations finish
 void UInteractionSubsystem::OnAIPriorityCalculationsComplete(TArray<FAIPriorityData> ProcessedData)
@@ -435,13 +467,13 @@ void UInteractionSubsystem::OnAIPriorityCalculationsComplete(TArray<FAIPriorityD
 			continue;
 		
 		// Apply the new sorted priority order
-		ApplyAIItemLoadState(Pawn, Data.ItemsWithDistances);
+		ApplyAIItemLoadState(Pawn, Data.Items);
 	}
 }
 
 void UInteractionSubsystem::ApplyAIItemLoadState(
 	APawn* Pawn, 
-	const TArray<TPair<TWeakObjectPtr<AActor>, float>>& SortedItems)
+	const TArray<FAIPriorityItemSnapshot>& SortedItems)
 {
 	if (!Pawn)
 		return;
@@ -460,11 +492,11 @@ void UInteractionSubsystem::ApplyAIItemLoadState(
 			continue;
 		
 		// Find matching item in sorted results
-		for (const auto& SortedPair : SortedItems)
+		for (const FAIPriorityItemSnapshot& SortedItem : SortedItems)
 		{
-			if (SortedPair.Key == ItemList[i].Item)
+			if (SortedItem.Item == ItemList[i].Item)
 			{
-				ItemList[i].DistanceSquared = SortedPair.Value;
+				ItemList[i].DistanceSquared = SortedItem.DistanceSquared;
 				break;
 			}
 		}
@@ -763,6 +795,8 @@ void UInteractionSubsystem::RequestServerValidation(APawn* ClientPawn, AActor* T
 
 void UInteractionSubsystem::LaunchBatchValidation()
 {
+	INTERACTION_SCOPE_TIMING(LaunchBatchValidation, STAT_Interaction_LaunchBatchValidation);
+	
 	UWorld* World = GetGameInstance()->GetWorld();
 	if (!World || PendingValidations.Num() == 0)
 		return;
@@ -816,6 +850,8 @@ void UInteractionSubsystem::LaunchBatchValidation()
 		ActiveValidations.Add(ValidationTrace);
 	}
 	
+	INC_DWORD_STAT_BY(STAT_Interaction_NumValidations, PendingValidations.Num());
+	
 	// Clear pending validations (they're now active)
 	PendingValidations.Empty();
 }
@@ -938,6 +974,8 @@ void UInteractionSubsystem::TickStaggeredAITraces(float DeltaTime)
 	if (RegisteredAIPawns.Num() == 0 || !bUseAsyncTraces)
 		return;
 	
+	INTERACTION_SCOPE_TIMING(TickStaggeredAITraces, STAT_Interaction_TickStaggeredAITraces);
+	
 	// Update N AI pawns per frame in round-robin fashion
 	int32 TracesThisFrame = FMath::Min(AITracesPerFrame, RegisteredAIPawns.Num());
 	
@@ -959,6 +997,7 @@ void UInteractionSubsystem::TickStaggeredAITraces(float DeltaTime)
 		// Update this AI pawn
 		APawn* AIPawn = RegisteredAIPawns[CurrentAIUpdateIndex].Get();
 		RequestAsyncFocusUpdate(AIPawn);
+		INC_DWORD_STAT(STAT_Interaction_NumAITraces);
 		
 		// Move to next AI
 		CurrentAIUpdateIndex++;
@@ -1024,13 +1063,15 @@ AActor* UInteractionSubsystem::GetBestInteractableForPlayer(APawn* Pawn) const
     // PLAYER-ONLY CODE BELOW
     // ========================================================================
 
-    TArray<AActor*> Candidates;
+    // Scratch arrays are members, so repeated focus updates reuse their capacity
+    TArray<AActor*>& Candidates = CandidateScratch;
+    Candidates.Reset();
 
     // ========================================================================
     // SPATIAL HASH OPTIMIZATION - ACTIVATED FOR TESTING
     // ========================================================================
     // Using spatial hash instead of InteractorComponent sphere for performance testing
-    Candidates = GetNearbyInteractables(Pawn->GetActorLocation(), GlobalFullInteractionDistanceUI);
+    GetNearbyInteractables(Pawn->GetActorLocation(), GlobalFullInteractionDistanceUI, Candidates);
     // This is 10-40x faster in dense areas (200+ items)
     // ========================================================================
 
@@ -1056,20 +1097,20 @@ AActor* UInteractionSubsystem::GetBestInteractableForPlayer(APawn* Pawn) const
         return nullptr;
     }
 
-    // ✅ Filter: Must be valid interactable
-    Candidates = Candidates.FilterByPredicate([](AActor* Actor)
+    // ✅ Filter in place: Must be valid interactable
+    Candidates.RemoveAllSwap([](AActor* Actor)
     {
         if (!Actor || !Actor->Implements<UInteractableInterface>())
-            return false;
+            return true;
             
         if (!IInteractableInterface::Execute_GetInteractionEnabled(Actor))
-            return false;
+            return true;
             
         if (!IInteractableInterface::Execute_IsCurrentlyInteractable(Actor))
-            return false;
+            return true;
             
-        return true;
-    });
+        return false;
+    }, EAllowShrinking::No);
 
     if (Candidates.Num() == 0)
     {
@@ -1096,7 +1137,7 @@ AActor* UInteractionSubsystem::GetBestInteractableForPlayer(APawn* Pawn) const
     Params.bTraceComplex = false;  // Use simple collision for performance
     Params.bReturnPhysicalMaterial = false;
 
-    TArray<FHitResult> HitResults;
+    TArray<FHitResult>& HitResults = HitResultScratch;
     
     // IMPORTANT: Use ObjectType trace instead of Channel trace to get ALL objects
     // This ensures we detect interactable objects even if they don't block Visibility
@@ -1145,7 +1186,8 @@ AActor* UInteractionSubsystem::GetBestInteractableForPlayer(APawn* Pawn) const
     
     // Find valid candidates that were hit by the trace
     // CRITICAL: Check ALL hits, not just first - trace may hit environment first!
-    TArray<AActor*> HitCandidates;
+    TArray<AActor*>& HitCandidates = HitCandidateScratch;
+    HitCandidates.Reset();
     for (const FHitResult& Hit : HitResults)
     {
         AActor* HitActor = Hit.GetActor();
@@ -1210,7 +1252,8 @@ AActor* UInteractionSubsystem::GetBestInteractableForPlayer(APawn* Pawn) const
     // ========================================================================
     
     int32 HighestPriority = TNumericLimits<int32>::Min();
-    TArray<AActor*> HighestPriorityCandidates;
+    TArray<AActor*>& HighestPriorityCandidates = PriorityCandidateScratch;
+    HighestPriorityCandidates.Reset();
     
     for (AActor* Actor : HitCandidates)
     {
@@ -1218,7 +1261,7 @@ AActor* UInteractionSubsystem::GetBestInteractableForPlayer(APawn* Pawn) const
         if (Priority > HighestPriority)
         {
             HighestPriority = Priority;
-            HighestPriorityCandidates.Empty();
+            HighestPriorityCandidates.Reset();
             HighestPriorityCandidates.Add(Actor);
         }
         else if (Priority == HighestPriority)
@@ -1994,6 +2037,10 @@ void UInteractionSubsystem::StopAIUpdateTimer()
 		World->GetTimerManager().ClearTimer(AIUpdateTimerHandle);
 		AIUpdateTimerHandle.Invalidate();
 		
+		// Results of a job launched by the old timer must not land after a stop/restart
+		++AIPriorityJobGeneration;
+		bAIPriorityJobInFlight = false;
+		
 		UE_LOG(LogInteractableSubsystem, Log, TEXT("⏹️ AI Priority Update Timer stopped"));
 	}
 }
@@ -2087,6 +2134,8 @@ void UInteractionSubsystem::UpdateAllPlayersFocus_Batched()
 
 void UInteractionSubsystem::LaunchBatchTraces()
 {
+	INTERACTION_SCOPE_TIMING(LaunchBatchTraces, STAT_Interaction_LaunchBatchTraces);
+	
 	UWorld* World = GetWorld();
 	if (!World)
 		return;
@@ -2122,6 +2171,7 @@ void UInteractionSubsystem::LaunchBatchTraces()
         
 		// Store handle in request
 		Request.Handle = Handle;
+		INC_DWORD_STAT(STAT_Interaction_NumBatchTraces);
 	}
 	
 
@@ -2130,6 +2180,8 @@ void UInteractionSubsystem::LaunchBatchTraces()
 
 void UInteractionSubsystem::OnBatchedTraceComplete(const FTraceHandle& Handle, FTraceDatum& Data, int32 RequestID)
 {
+	INTERACTION_SCOPE_TIMING(OnBatchedTraceComplete, STAT_Interaction_OnBatchedTraceComplete);
+	
 	// Validate request ID
 	if (!PendingBatchTraces.IsValidIndex(RequestID))
 	{
@@ -2174,8 +2226,8 @@ void UInteractionSubsystem::OnBatchComplete()
 	UE_LOG(LogInteractableSubsystem, Verbose, TEXT("Batch complete: %d/%d traces finished"), 
 		CompletedBatchTraces, TotalBatchTraces);
     
-	// Clear batch data to free memory
-	PendingBatchTraces.Empty();
+	// Clear batch data (keep capacity - next pass reuses it without allocating)
+	PendingBatchTraces.Reset();
 	CompletedBatchTraces = 0;
 	TotalBatchTraces = 0;
     
@@ -2275,7 +2327,7 @@ bool UInteractionSubsystem::ShouldUseBatchedTraces() const
 
 void UInteractionSubsystem::GetLocalPlayerPawns(TArray<APawn*>& OutLocalPawns) const
 {
-    OutLocalPawns.Empty();
+    OutLocalPawns.Reset();
     
     UWorld* World = GetWorld();
     if (!World)
@@ -2331,15 +2383,15 @@ void UInteractionSubsystem::UpdateSplitScreen()
         return;
     }
     
-    // Get only local players
-    TArray<APawn*> LocalPawns;
+    // Get only local players (member scratch - no allocation per pass)
+    TArray<APawn*>& LocalPawns = LocalPawnsScratch;
     GetLocalPlayerPawns(LocalPawns);
     
     if (LocalPawns.Num() == 0)
         return;
     
     // Clear previous batch data
-    PendingBatchTraces.Empty();
+    PendingBatchTraces.Reset();
     CompletedBatchTraces = 0;
     TotalBatchTraces = 0;
     
@@ -2398,14 +2450,14 @@ void UInteractionSubsystem::UpdateListenServer()
     }
     
     // Get only local players on host machine
-    TArray<APawn*> LocalPawns;
+    TArray<APawn*>& LocalPawns = LocalPawnsScratch;
     GetLocalPlayerPawns(LocalPawns);
     
     // If we have multiple local players, batch them
 	if (LocalPawns.Num() > 1 && bUseBatchedTraces)
     {
         // Clear previous batch data
-        PendingBatchTraces.Empty();
+        PendingBatchTraces.Reset();
         CompletedBatchTraces = 0;
         TotalBatchTraces = 0;
         
@@ -2459,7 +2511,7 @@ void UInteractionSubsystem::UpdateListenServer()
 void UInteractionSubsystem::UpdateClient()
 {
     // Client: Only 1 local player, use individual async trace
-    TArray<APawn*> LocalPawns;
+    TArray<APawn*>& LocalPawns = LocalPawnsScratch;
     GetLocalPlayerPawns(LocalPawns);
     
     if (LocalPawns.Num() > 0)
@@ -2487,52 +2539,44 @@ void UInteractionSubsystem::UpdateFallback()
 
 TArray<AActor*> UInteractionSubsystem::GetNearbyInteractables(const FVector& Location, float Radius) const
 {
+	// Query timing lives in "stat Interaction" / PrintInteractionTimings
+	TArray<AActor*> Result;
+	Result.Reserve(64);
+	GetNearbyInteractables(Location, Radius, Result);
+	return Result;
+}
+
+int32 UInteractionSubsystem::GetNearbyInteractables(const FVector& Location, float Radius, TArray<AActor*>& OutActors) const
+{
+	INTERACTION_SCOPE_TIMING(GridQuery, STAT_Interaction_GridQuery);
+	INC_DWORD_STAT(STAT_Interaction_NumGridQueries);
+	
 	// Use spatial hash if enabled, otherwise fallback to brute force
 	if (bUseSpatialHashing && SpatialGrid)
 	{
-		// ⚡ FAST PATH: Use spatial hash (10-40x faster!)
-
-		// Measure spatial hash performance
-		double StartTime = FPlatformTime::Seconds();
-		TArray<AActor*> Result = SpatialGrid->GetActorsInRadius(Location, Radius);
-		double EndTime = FPlatformTime::Seconds();
-		double QueryTimeMs = (EndTime - StartTime) * 1000.0;
-
-		UE_LOG(LogTemp, Warning, TEXT("🔍 SPATIAL QUERY: %.6f ms | Found: %d actors | Radius: %.1f"), 
-			QueryTimeMs, Result.Num(), Radius);
-
-		return Result;
+		// ⚡ FAST PATH: Use spatial hash (10-40x faster!) - writes straight into caller storage
+		const int32 NumFound = SpatialGrid->GetActorsInRadius(Location, Radius, OutActors);
+		INC_DWORD_STAT_BY(STAT_Interaction_NumGridQueryResults, NumFound);
+		return NumFound;
 	}
-	else
+
+	// ⚠️ SLOW PATH: Brute force check all interactables
+	const int32 StartNum = OutActors.Num();
+	const float RadiusSq = Radius * Radius;
+	
+	for (const TWeakObjectPtr<AActor>& WeakActor : Interactables)
 	{
-		// ⚠️ SLOW PATH: Brute force check all interactables
-		
-		// Measure brute force performance
-		double StartTime = FPlatformTime::Seconds();
-		
-		TArray<AActor*> NearbyActors;
-		float RadiusSq = Radius * Radius;
-		
-		for (TWeakObjectPtr<AActor> WeakActor : Interactables)
+		if (AActor* Actor = WeakActor.Get())
 		{
-			if (AActor* Actor = WeakActor.Get())
+			if (FVector::DistSquared(Location, Actor->GetActorLocation()) <= RadiusSq)
 			{
-				float DistSq = FVector::DistSquared(Location, Actor->GetActorLocation());
-				if (DistSq <= RadiusSq)
-				{
-					NearbyActors.Add(Actor);
-				}
+				OutActors.Add(Actor);
 			}
 		}
-		
-		double EndTime = FPlatformTime::Seconds();
-		double QueryTimeMs = (EndTime - StartTime) * 1000.0;
-		
-		UE_LOG(LogTemp, Warning, TEXT("🐌 BRUTE FORCE QUERY: %.6f ms | Found: %d actors | Checked: %d total | Radius: %.1f"), 
-			QueryTimeMs, NearbyActors.Num(), Interactables.Num(), Radius);
-		
-		return NearbyActors;
 	}
+	
+	INC_DWORD_STAT_BY(STAT_Interaction_NumGridQueryResults, OutActors.Num() - StartNum);
+	return OutActors.Num() - StartNum;
 }
 
 void UInteractionSubsystem::NotifyActorMoved(AActor* Actor, const FVector& OldLocation)
@@ -2542,10 +2586,126 @@ void UInteractionSubsystem::NotifyActorMoved(AActor* Actor, const FVector& OldLo
 	
 	SpatialGrid->UpdateActorPosition(Actor, OldLocation);
 	
+	// Keep the batched mover pass in sync with manual updates (teleports etc.)
+	if (const int32* MoverIndex = TrackedMoverIndices.Find(Actor))
+	{
+		TrackedMoverLastLocations[*MoverIndex] = Actor->GetActorLocation();
+	}
+	
 	UE_LOG(LogInteractableSubsystem, VeryVerbose, 
 		TEXT("🗺️ Updated actor position in spatial grid: %s"), *Actor->GetName());
 }
 
+void UInteractionSubsystem::RegisterMovingInteractable(AActor* Actor, float MovementThreshold, float UpdateInterval)
+{
+	if (!Actor || TrackedMoverIndices.Contains(Actor))
+		return;
+	
+	const int32 Index = TrackedMovers.Add(Actor);
+	TrackedMoverKeys.Add(Actor);
+	TrackedMoverLastLocations.Add(Actor->GetActorLocation());
+	TrackedMoverThresholdsSq.Add(FMath::Square(MovementThreshold));
+	TrackedMoverIntervals.Add(FMath::Max(UpdateInterval, 0.f));
+	TrackedMoverElapsed.Add(0.f);
+	TrackedMoverIndices.Add(Actor, Index);
+	
+	if (UpdateInterval > 0.f)
+	{
+		ShortestTrackedMoverInterval = FMath::Min(ShortestTrackedMoverInterval, UpdateInterval);
+	}
+	
+	UE_LOG(LogInteractableSubsystem, VeryVerbose, TEXT("🗺️ Tracking mover %s (Threshold: %.1f, Interval: %.2f, Total: %d)"), 
+		*Actor->GetName(), MovementThreshold, UpdateInterval, TrackedMovers.Num());
+}
+
+void UInteractionSubsystem::UnregisterMovingInteractable(AActor* Actor)
+{
+	if (!Actor)
+		return;
+	
+	if (const int32* Index = TrackedMoverIndices.Find(Actor))
+	{
+		RemoveTrackedMoverAt(*Index);
+	}
+}
+
+void UInteractionSubsystem::RemoveTrackedMoverAt(int32 Index)
+{
+	TrackedMoverIndices.Remove(TrackedMoverKeys[Index]);
+	const float RemovedInterval = TrackedMoverIntervals[Index];
+	
+	TrackedMovers.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TrackedMoverKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TrackedMoverLastLocations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TrackedMoverThresholdsSq.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TrackedMoverIntervals.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TrackedMoverElapsed.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	
+	// Patch the mover that was swapped into the hole
+	if (TrackedMoverKeys.IsValidIndex(Index))
+	{
+		TrackedMoverIndices.Add(TrackedMoverKeys[Index], Index);
+	}
+	
+	// Only the shortest interval leaving needs a rescan
+	if (RemovedInterval > 0.f && RemovedInterval <= ShortestTrackedMoverInterval)
+	{
+		ShortestTrackedMoverInterval = MAX_flt;
+		for (const float Interval : TrackedMoverIntervals)
+		{
+			if (Interval > 0.f)
+			{
+				ShortestTrackedMoverInterval = FMath::Min(ShortestTrackedMoverInterval, Interval);
+			}
+		}
+	}
+}
+
+void UInteractionSubsystem::TickMovingInteractables(float DeltaTime)
+{
+	if (TrackedMovers.Num() == 0)
+		return;
+	
+	MovingInteractableTimeAccumulator += DeltaTime;
+	if (MovingInteractableTimeAccumulator < FMath::Min(MovingInteractableUpdateInterval, ShortestTrackedMoverInterval))
+		return;
+	
+	const float Elapsed = MovingInteractableTimeAccumulator;
+	MovingInteractableTimeAccumulator = 0.f;
+	
+	const bool bCanUpdateGrid = bUseSpatialHashing && SpatialGrid.IsValid();
+	
+	// Walk backwards so dead movers can be swap-removed in place
+	for (int32 Index = TrackedMovers.Num() - 1; Index >= 0; --Index)
+	{
+		AActor* Actor = TrackedMovers[Index].Get();
+		if (!Actor)
+		{
+			// Destroyed without EndPlay reaching us
+			RemoveTrackedMoverAt(Index);
+			continue;
+		}
+		
+		// Movers with their own interval wait for it; the rest use the subsystem's
+		TrackedMoverElapsed[Index] += Elapsed;
+		const float Interval = TrackedMoverIntervals[Index] > 0.f ? TrackedMoverIntervals[Index] : MovingInteractableUpdateInterval;
+		if (TrackedMoverElapsed[Index] < Interval)
+			continue;
+		TrackedMoverElapsed[Index] = 0.f;
+		
+		const FVector CurrentLocation = Actor->GetActorLocation();
+		if (FVector::DistSquared(TrackedMoverLastLocations[Index], CurrentLocation) < TrackedMoverThresholdsSq[Index])
+			continue;
+		
+		// Crossed the threshold - re-bin in the grid
+		if (bCanUpdateGrid)
+		{
+			SpatialGrid->UpdateActorPosition(Actor, TrackedMoverLastLocations[Index]);
+		}
+		TrackedMoverLastLocations[Index] = CurrentLocation;
+	}
+}
+
 void UInteractionSubsystem::DebugDrawSpatialGrid(const FVector& Center, int32 Radius)
 {
 	if (!SpatialGrid)
@@ -2573,4 +2733,31 @@ void UInteractionSubsystem::PrintSpatialGridStats()
 	}
 	
 	SpatialGrid->PrintGridStats();
-}
\ No newline at end of file
+}
+
+void UInteractionSubsystem::ConfigureSpatialGrid(float CellSize, float CellHeight)
+{
+	SpatialGridCellSize = FMath::Clamp(CellSize, 500.f, 5000.f);
+	SpatialGridCellHeight = FMath::Clamp(CellHeight, 0.f, 5000.f);
+	
+	if (!bUseSpatialHashing)
+	{
+		UE_LOG(LogInteractableSubsystem, Warning, TEXT("Spatial Grid layout stored, but bUseSpatialHashing is disabled"));
+		return;
+	}
+	
+	// Console commands resolve the grid through the subsystem, so they pick up the rebuilt one as-is
+	SpatialGrid = MakeUnique<FSpatialHashGrid>(SpatialGridCellSize, SpatialGridCellHeight);
+	for (const TWeakObjectPtr<AActor>& WeakActor : Interactables)
+	{
+		if (AActor* Actor = WeakActor.Get())
+		{
+			SpatialGrid->RegisterActor(Actor);
+		}
+	}
+	
+	UE_LOG(LogInteractableSubsystem, Log, TEXT("🗺️ Spatial Hash Grid rebuilt (Cell Size: %.1f, Cell Height: %.1f, Mode: %s, Actors: %d)"), 
+		SpatialGridCellSize, SpatialGridCellHeight, 
+		SpatialGrid->IsVolumetric() ? TEXT("Volumetric") : TEXT("Planar"),
+		SpatialGrid->GetTotalActorCount());
+}
@@ -1,17 +1,32 @@
 // SpatialHashGrid.cpp
-// Implementation of high-performance 2D spatial hash grid
+// Implementation of high-performance spatial hash grid (planar or volumetric cells)
 
 #include "SpatialHashGrid.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/World.h"
 #include "InteractionSubsystem.h"
+#include "Engine/TargetPoint.h"
+#include "HAL/MemoryBase.h"
 
-FSpatialHashGrid::FSpatialHashGrid(float InCellSize)
+namespace SpatialHashGridConstants
+{
+    // Initial cell table capacity (must be a power of two)
+    constexpr int32 InitialCellCapacity = 256;
+
+    // Grow the cell table once used slots exceed this fraction of capacity
+    constexpr float MaxLoadFactor = 0.5f;
+}
+
+FSpatialHashGrid::FSpatialHashGrid(float InCellSize, float InCellHeight)
     : CellSize(InCellSize)
+    , InvCellSize(InCellSize > 0.f ? 1.f / InCellSize : 1.f)
+    , CellHeight(FMath::Max(InCellHeight, 0.f))
+    , InvCellHeight(InCellHeight > 0.f ? 1.f / InCellHeight : 0.f)
 {
     // Reserve some space to avoid initial allocations
-    Grid.Reserve(256);
-    ActorToCell.Reserve(512);
+    CellSlots.SetNum(SpatialHashGridConstants::InitialCellCapacity);
+    Entries.Reserve(512);
+    ActorToHandle.Reserve(512);
 }
 
 FSpatialHashGrid::~FSpatialHashGrid()
@@ -25,32 +40,37 @@ void FSpatialHashGrid::RegisterActor(AActor* Actor)
         return;
 
     // Check if already registered
-    TWeakObjectPtr<AActor> WeakActor(Actor);
-    if (ActorToCell.Contains(WeakActor))
+    if (ActorToHandle.Contains(Actor))
     {
         UE_LOG(LogTemp, Warning, TEXT("Actor %s already registered in spatial grid"), *Actor->GetName());
         return;
     }
 
-    // Calculate grid cell
-    FIntPoint Cell = WorldToGrid(Actor->GetActorLocation());
-    
-    // Add to grid and reverse lookup
-    AddActorToCell(Actor, Cell);
+    const FVector Location = Actor->GetActorLocation();
+
+    const int32 Handle = AllocateHandle();
+    Entries[Handle].Actor = Actor;
+    ActorToHandle.Add(Actor, Handle);
+
+    // Add dense record to its cell
+    AddRecordToCell(Handle, WorldToGrid(Location), Location);
 }
 
 void FSpatialHashGrid::UnregisterActor(AActor* Actor)
 {
-    if (!IsValid(Actor))
+    if (!Actor)
         return;
 
-    TWeakObjectPtr<AActor> WeakActor(Actor);
-    
-    // Find which cell this actor is in
-    if (FIntPoint* Cell = ActorToCell.Find(WeakActor))
-    {
-        RemoveActorFromCell(Actor, *Cell);
-    }
+    int32 Handle = INDEX_NONE;
+    if (!ActorToHandle.RemoveAndCopyValue(Actor, Handle))
+        return;
+
+    RemoveRecordFromCell(Handle);
+
+    // Recycle handle
+    Entries[Handle].Actor.Reset();
+    FreeHandles.Add(Handle);
+    NumActiveEntries--;
 }
 
 void FSpatialHashGrid::UpdateActorPosition(AActor* Actor, const FVector& OldLocation)
@@ -58,66 +78,45 @@ void FSpatialHashGrid::UpdateActorPosition(AActor* Actor, const FVector& OldLoca
     if (!IsValid(Actor))
         return;
 
-    FIntPoint OldCell = WorldToGrid(OldLocation);
-    FIntPoint NewCell = WorldToGrid(Actor->GetActorLocation());
+    const int32* HandlePtr = ActorToHandle.Find(Actor);
+    if (!HandlePtr)
+        return;
 
-    // Only update if actor moved to a different cell
-    if (OldCell != NewCell)
-    {
-        TWeakObjectPtr<AActor> WeakActor(Actor);
-        
-        // Remove from old cell
-        if (TArray<TWeakObjectPtr<AActor>>* CellActors = Grid.Find(OldCell))
-        {
-            CellActors->Remove(WeakActor);
-            
-            // Clean up empty cells
-            if (CellActors->Num() == 0)
-            {
-                Grid.Remove(OldCell);
-            }
-        }
+    const int32 Handle = *HandlePtr;
+    const FGridEntry& Entry = Entries[Handle];
+    const FVector NewLocation = Actor->GetActorLocation();
+    const FIntVector NewCell = WorldToGrid(NewLocation);
 
-        // Add to new cell
-        AddActorToCell(Actor, NewCell);
+    // Same cell: just refresh the cached position in place
+    if (CellSlots[Entry.SlotIndex].Key == NewCell)
+    {
+        CellSlots[Entry.SlotIndex].Records[Entry.RecordIndex].Position = FVector3f(NewLocation);
+        return;
     }
+
+    // Crossed a cell boundary: swap-remove from old cell, append to new one
+    RemoveRecordFromCell(Handle);
+    AddRecordToCell(Handle, NewCell, NewLocation);
 }
 
 void FSpatialHashGrid::Clear()
 {
-    Grid.Empty();
-    ActorToCell.Empty();
+    CellSlots.Reset();
+    CellSlots.SetNum(SpatialHashGridConstants::InitialCellCapacity);
+    NumUsedSlots = 0;
+    NumOccupiedCells = 0;
+
+    Entries.Reset();
+    FreeHandles.Reset();
+    NumActiveEntries = 0;
+    ActorToHandle.Reset();
 }
 
 TArray<AActor*> FSpatialHashGrid::GetNearbyActors(const FVector& Location, int32 CellRadius) const
 {
     TArray<AActor*> Result;
     Result.Reserve(64); // Pre-allocate reasonable amount
-
-    FIntPoint CenterCell = WorldToGrid(Location);
-
-    // Check surrounding cells in a square pattern
-    // For CellRadius=1: checks 3x3 = 9 cells
-    // For CellRadius=2: checks 5x5 = 25 cells
-    for (int32 X = -CellRadius; X <= CellRadius; X++)
-    {
-        for (int32 Y = -CellRadius; Y <= CellRadius; Y++)
-        {
-            FIntPoint CheckCell = CenterCell + FIntPoint(X, Y);
-            
-            if (const TArray<TWeakObjectPtr<AActor>>* CellActors = Grid.Find(CheckCell))
-            {
-                for (const TWeakObjectPtr<AActor>& WeakActor : *CellActors)
-                {
-                    if (WeakActor.IsValid())
-                    {
-                        Result.Add(WeakActor.Get());
-                    }
-                }
-            }
-        }
-    }
-
+    GetNearbyActors(Location, CellRadius, Result);
     return Result;
 }
 
@@ -125,76 +124,54 @@ TArray<AActor*> FSpatialHashGrid::GetActorsInRadius(const FVector& Center, float
 {
     TArray<AActor*> Result;
     Result.Reserve(64);
-
-    // Calculate how many cells we need to check
-    int32 CellRadius = FMath::CeilToInt(Radius / CellSize);
-    float RadiusSq = Radius * Radius;
-
-    FIntPoint CenterCell = WorldToGrid(Center);
-
-    // Check cells in range
-    for (int32 X = -CellRadius; X <= CellRadius; X++)
-    {
-        for (int32 Y = -CellRadius; Y <= CellRadius; Y++)
-        {
-            FIntPoint CheckCell = CenterCell + FIntPoint(X, Y);
-            
-            if (const TArray<TWeakObjectPtr<AActor>>* CellActors = Grid.Find(CheckCell))
-            {
-                for (const TWeakObjectPtr<AActor>& WeakActor : *CellActors)
-                {
-                    if (AActor* Actor = WeakActor.Get())
-                    {
-                        // Distance check for precision
-                        float DistSq = FVector::DistSquared(Center, Actor->GetActorLocation());
-                        if (DistSq <= RadiusSq)
-                        {
-                            Result.Add(Actor);
-                        }
-                    }
-                }
-            }
-        }
-    }
-
+    GetActorsInRadius(Center, Radius, Result);
     return Result;
 }
 
 TArray<AActor*> FSpatialHashGrid::GetActorsInCell(const FVector& Location) const
 {
     TArray<AActor*> Result;
-    
-    FIntPoint Cell = WorldToGrid(Location);
-    
-    if (const TArray<TWeakObjectPtr<AActor>>* CellActors = Grid.Find(Cell))
+    GetActorsInCell(Location, Result);
+    return Result;
+}
+
+int32 FSpatialHashGrid::GetNearbyActors(const FVector& Location, int32 CellRadius, TArray<AActor*>& OutActors) const
+{
+    const int32 StartNum = OutActors.Num();
+
+    // Check surrounding cells in a square pattern
+    // For CellRadius=1: checks 3x3 = 9 cells
+    // For CellRadius=2: checks 5x5 = 25 cells
+    ForEachNearbyActor(Location, CellRadius, [&OutActors](AActor* Actor)
     {
-        Result.Reserve(CellActors->Num());
-        
-        for (const TWeakObjectPtr<AActor>& WeakActor : *CellActors)
-        {
-            if (WeakActor.IsValid())
-            {
-                Result.Add(WeakActor.Get());
-            }
-        }
-    }
+        OutActors.Add(Actor);
+    });
 
-    return Result;
+    return OutActors.Num() - StartNum;
 }
 
-int32 FSpatialHashGrid::GetTotalActorCount() const
+int32 FSpatialHashGrid::GetActorsInRadius(const FVector& Center, float Radius, TArray<AActor*>& OutActors) const
 {
-    int32 Count = 0;
-    for (const auto& Pair : Grid)
+    const int32 StartNum = OutActors.Num();
+
+    ForEachActorInRadius(Center, Radius, [&OutActors](AActor* Actor)
     {
-        Count += Pair.Value.Num();
-    }
-    return Count;
+        OutActors.Add(Actor);
+    });
+
+    return OutActors.Num() - StartNum;
 }
 
-int32 FSpatialHashGrid::GetCellCount() const
+int32 FSpatialHashGrid::GetActorsInCell(const FVector& Location, TArray<AActor*>& OutActors) const
 {
-    return Grid.Num();
+    const int32 StartNum = OutActors.Num();
+
+    ForEachActorInCell(Location, [&OutActors](AActor* Actor)
+    {
+        OutActors.Add(Actor);
+    });
+
+    return OutActors.Num() - StartNum;
 }
 
 void FSpatialHashGrid::DebugDrawGrid(UWorld* World, const FVector& Center, int32 Radius, float Duration) const
@@ -202,37 +179,34 @@ void FSpatialHashGrid::DebugDrawGrid(UWorld* World, const FVector& Center, int32
     if (!World)
         return;
 
-    FIntPoint CenterCell = WorldToGrid(Center);
+    // Volumetric grids draw the layer the center point sits in
+    FIntVector CenterCell = WorldToGrid(Center);
 
     for (int32 X = -Radius; X <= Radius; X++)
     {
         for (int32 Y = -Radius; Y <= Radius; Y++)
         {
-            FIntPoint Cell = CenterCell + FIntPoint(X, Y);
+            FIntVector Cell = CenterCell + FIntVector(X, Y, 0);
             FVector CellCenter = GridToWorld(Cell);
-            
-            // Draw cell boundaries
-            FVector Min(CellCenter.X - CellSize * 0.5f, CellCenter.Y - CellSize * 0.5f, CellCenter.Z);
-            FVector Max(CellCenter.X + CellSize * 0.5f, CellCenter.Y + CellSize * 0.5f, CellCenter.Z + 100.f);
-            
+
             FColor CellColor = FColor::Green;
-            
+
             // Highlight cells with actors
-            if (const TArray<TWeakObjectPtr<AActor>>* CellActors = Grid.Find(Cell))
+            if (const TArray<FCellRecord>* Records = FindCellRecords(Cell))
             {
-                if (CellActors->Num() > 0)
+                if (Records->Num() > 0)
                 {
                     CellColor = FColor::Red;
-                    
+
                     // Draw actor count
-                    DrawDebugString(World, CellCenter + FVector(0, 0, 150.f), 
-                        FString::Printf(TEXT("%d"), CellActors->Num()), 
+                    DrawDebugString(World, CellCenter + FVector(0, 0, 150.f),
+                        FString::Printf(TEXT("%d"), Records->Num()),
                         nullptr, CellColor, Duration);
                 }
             }
-            
-            DrawDebugBox(World, CellCenter + FVector(0, 0, 50.f), 
-                FVector(CellSize * 0.5f, CellSize * 0.5f, 50.f), 
+
+            DrawDebugBox(World, CellCenter + FVector(0, 0, 50.f),
+                FVector(CellSize * 0.5f, CellSize * 0.5f, 50.f),
                 CellColor, false, Duration, 0, 2.f);
         }
     }
@@ -245,66 +219,359 @@ void FSpatialHashGrid::PrintGridStats() const
     float AvgActorsPerCell = TotalCells > 0 ? (float)TotalActors / TotalCells : 0.f;
 
     UE_LOG(LogTemp, Log, TEXT("=== Spatial Grid Stats ==="));
+    UE_LOG(LogTemp, Log, TEXT("Cell Mode: %s"), IsVolumetric() ? TEXT("Volumetric (X/Y/Z)") : TEXT("Planar (X/Y)"));
     UE_LOG(LogTemp, Log, TEXT("Cell Size: %.1f"), CellSize);
+    if (IsVolumetric())
+    {
+        UE_LOG(LogTemp, Log, TEXT("Cell Height: %.1f"), CellHeight);
+    }
     UE_LOG(LogTemp, Log, TEXT("Total Cells: %d"), TotalCells);
     UE_LOG(LogTemp, Log, TEXT("Total Actors: %d"), TotalActors);
     UE_LOG(LogTemp, Log, TEXT("Avg Actors/Cell: %.2f"), AvgActorsPerCell);
-
-    // Find hotspots
+    UE_LOG(LogTemp, Log, TEXT("Cell Table: %d/%d slots used (%.0f%% load)"),
+        NumUsedSlots, CellSlots.Num(), CellSlots.Num() > 0 ? 100.f * NumUsedSlots / CellSlots.Num() : 0.f);
+
+    // Find hotspots and build a power-of-two occupancy histogram:
+    // bucket 0 = 1 actor, 1 = 2-3, 2 = 4-7, ... last bucket = everything above
+    constexpr int32 NumHistogramBuckets = 10;
+    int32 CellsPerBucket[NumHistogramBuckets] = {};
+    int32 ActorsPerBucket[NumHistogramBuckets] = {};
     int32 MaxActorsInCell = 0;
-    for (const auto& Pair : Grid)
+
+    for (const FCellSlot& Slot : CellSlots)
     {
-        MaxActorsInCell = FMath::Max(MaxActorsInCell, Pair.Value.Num());
+        const int32 Occupancy = Slot.Records.Num();
+        if (Occupancy == 0)
+            continue;
+
+        MaxActorsInCell = FMath::Max(MaxActorsInCell, Occupancy);
+
+        const int32 Bucket = FMath::Min((int32)FMath::FloorLog2((uint32)Occupancy), NumHistogramBuckets - 1);
+        CellsPerBucket[Bucket]++;
+        ActorsPerBucket[Bucket] += Occupancy;
     }
     UE_LOG(LogTemp, Log, TEXT("Max Actors in Single Cell: %d"), MaxActorsInCell);
+
+    // Cells show the spread, actors show where queries actually pay - if most actors sit
+    // in the top buckets the cell size is too large (or the level needs volumetric cells)
+    UE_LOG(LogTemp, Log, TEXT("--- Bucket Occupancy Histogram ---"));
+    UE_LOG(LogTemp, Log, TEXT("%-12s %8s %8s  %s"), TEXT("Actors/Cell"), TEXT("Cells"), TEXT("Actors"), TEXT("% of actors"));
+    for (int32 Bucket = 0; Bucket < NumHistogramBuckets; ++Bucket)
+    {
+        if (CellsPerBucket[Bucket] == 0)
+            continue;
+
+        const int32 RangeMin = 1 << Bucket;
+        const FString RangeLabel = (Bucket == NumHistogramBuckets - 1)
+            ? FString::Printf(TEXT("%d+"), RangeMin)
+            : (RangeMin == (2 << Bucket) - 1 ? FString::FromInt(RangeMin) : FString::Printf(TEXT("%d-%d"), RangeMin, (2 << Bucket) - 1));
+
+        const float ActorPercent = TotalActors > 0 ? 100.f * ActorsPerBucket[Bucket] / TotalActors : 0.f;
+        const FString Bar = FString::ChrN(FMath::RoundToInt(ActorPercent * 0.4f), TEXT('#'));
+
+        UE_LOG(LogTemp, Log, TEXT("%-12s %8d %8d  %5.1f%% %s"),
+            *RangeLabel, CellsPerBucket[Bucket], ActorsPerBucket[Bucket], ActorPercent, *Bar);
+    }
 }
 
 // Private helper methods
 
-void FSpatialHashGrid::AddActorToCell(AActor* Actor, const FIntPoint& Cell)
+int32 FSpatialHashGrid::FindSlot(const FIntVector& Cell) const
 {
-    TWeakObjectPtr<AActor> WeakActor(Actor);
-    
-    // Add to grid cell
-    Grid.FindOrAdd(Cell).AddUnique(WeakActor);
-    
-    // Update reverse lookup
-    ActorToCell.Add(WeakActor, Cell);
+    const int32 Mask = CellSlots.Num() - 1;
+    int32 Index = static_cast<int32>(HashCell(Cell) & Mask);
+
+    // Linear probe until we hit the key or an unused slot
+    while (CellSlots[Index].bUsed)
+    {
+        if (CellSlots[Index].Key == Cell)
+        {
+            return Index;
+        }
+        Index = (Index + 1) & Mask;
+    }
+
+    return INDEX_NONE;
 }
 
-void FSpatialHashGrid::RemoveActorFromCell(AActor* Actor, const FIntPoint& Cell)
+int32 FSpatialHashGrid::FindOrAddSlot(const FIntVector& Cell)
 {
-    TWeakObjectPtr<AActor> WeakActor(Actor);
-    
-    // Remove from grid cell
-    if (TArray<TWeakObjectPtr<AActor>>* CellActors = Grid.Find(Cell))
+    const int32 Existing = FindSlot(Cell);
+    if (Existing != INDEX_NONE)
+        return Existing;
+
+    // Keep probe chains short. Rehashing drops empty cells, so only double
+    // when the live cells alone would still exceed half the load budget
+    if (NumUsedSlots + 1 > CellSlots.Num() * SpatialHashGridConstants::MaxLoadFactor)
     {
-        CellActors->Remove(WeakActor);
-        
-        // Clean up empty cells
-        if (CellActors->Num() == 0)
+        const bool bNeedsGrow = (NumOccupiedCells + 1) > CellSlots.Num() * SpatialHashGridConstants::MaxLoadFactor * 0.5f;
+        RehashCellTable(bNeedsGrow ? CellSlots.Num() * 2 : CellSlots.Num());
+    }
+
+    const int32 Mask = CellSlots.Num() - 1;
+    int32 Index = static_cast<int32>(HashCell(Cell) & Mask);
+    while (CellSlots[Index].bUsed)
+    {
+        Index = (Index + 1) & Mask;
+    }
+
+    CellSlots[Index].Key = Cell;
+    CellSlots[Index].bUsed = true;
+    NumUsedSlots++;
+    return Index;
+}
+
+void FSpatialHashGrid::RehashCellTable(int32 NewCapacity)
+{
+    TArray<FCellSlot> OldSlots = MoveTemp(CellSlots);
+    CellSlots.SetNum(NewCapacity);
+    NumUsedSlots = 0;
+
+    // Empty cells are dropped here, so the table never fills up with dead keys
+    for (FCellSlot& OldSlot : OldSlots)
+    {
+        if (!OldSlot.bUsed || OldSlot.Records.Num() == 0)
+            continue;
+
+        const int32 Mask = CellSlots.Num() - 1;
+        int32 Index = static_cast<int32>(HashCell(OldSlot.Key) & Mask);
+        while (CellSlots[Index].bUsed)
+        {
+            Index = (Index + 1) & Mask;
+        }
+
+        FCellSlot& NewSlot = CellSlots[Index];
+        NewSlot.Key = OldSlot.Key;
+        NewSlot.bUsed = true;
+        NewSlot.Records = MoveTemp(OldSlot.Records);
+        NumUsedSlots++;
+
+        // Slot indices changed - patch entries that point into this cell
+        for (const FCellRecord& Record : NewSlot.Records)
         {
-            Grid.Remove(Cell);
+            Entries[Record.Handle].SlotIndex = Index;
+        }
+    }
+}
+
+const TArray<FSpatialHashGrid::FCellRecord>* FSpatialHashGrid::FindCellRecords(const FIntVector& Cell) const
+{
+    const int32 SlotIndex = FindSlot(Cell);
+    return SlotIndex != INDEX_NONE ? &CellSlots[SlotIndex].Records : nullptr;
+}
+
+int32 FSpatialHashGrid::AllocateHandle()
+{
+    NumActiveEntries++;
+
+    if (FreeHandles.Num() > 0)
+    {
+        return FreeHandles.Pop(EAllowShrinking::No);
+    }
+
+    return Entries.AddDefaulted();
+}
+
+void FSpatialHashGrid::AddRecordToCell(int32 Handle, const FIntVector& Cell, const FVector& Location)
+{
+    const int32 SlotIndex = FindOrAddSlot(Cell);
+    TArray<FCellRecord>& Records = CellSlots[SlotIndex].Records;
+
+    if (Records.Num() == 0)
+    {
+        NumOccupiedCells++;
+    }
+
+    FGridEntry& Entry = Entries[Handle];
+    Entry.SlotIndex = SlotIndex;
+    Entry.RecordIndex = Records.Add({ Handle, FVector3f(Location) });
+}
+
+void FSpatialHashGrid::RemoveRecordFromCell(int32 Handle)
+{
+    FGridEntry& Entry = Entries[Handle];
+    if (Entry.SlotIndex == INDEX_NONE)
+        return;
+
+    TArray<FCellRecord>& Records = CellSlots[Entry.SlotIndex].Records;
+    const int32 RecordIndex = Entry.RecordIndex;
+
+    // Swap-remove keeps the cell dense; patch the record that moved into the hole
+    Records.RemoveAtSwap(RecordIndex, 1, EAllowShrinking::No);
+    if (Records.IsValidIndex(RecordIndex))
+    {
+        Entries[Records[RecordIndex].Handle].RecordIndex = RecordIndex;
+    }
+
+    // Empty slots keep their key (probe chains stay intact) and are dropped on the next rehash
+    if (Records.Num() == 0)
+    {
+        NumOccupiedCells--;
+    }
+
+    Entry.SlotIndex = INDEX_NONE;
+    Entry.RecordIndex = INDEX_NONE;
+}
+
+
+// ============================================================================
+// QUERY ALLOCATION BENCHMARK (development builds only)
+// ============================================================================
+
+#if !UE_BUILD_SHIPPING
+namespace SpatialHashGridBenchmark
+{
+    /**
+     * Scoped reader of the engine's global allocation call counters.
+     * Nothing is swapped out; the counters are process-wide, so allocations made by other
+     * threads during the window are included and the result is an upper bound.
+     * The counters are only maintained when stats are compiled in.
+     */
+    struct FScopedAllocationCounter
+    {
+        FScopedAllocationCounter()
+            : StartCalls(ReadCalls())
+        {
+        }
+
+        int64 GetAllocations() const { return (int64)(ReadCalls() - StartCalls); }
+
+        static bool IsAvailable() { return UE_STATS != 0; }
+
+    private:
+        static uint64 ReadCalls()
+        {
+#if UE_STATS
+            return FMalloc::TotalMallocCalls.load(std::memory_order_relaxed)
+                + FMalloc::TotalReallocCalls.load(std::memory_order_relaxed);
+#else
+            return 0;
+#endif
+        }
+
+        uint64 StartCalls;
+    };
+
+    /** Runs Query NumQueries times inside an allocation counting scope, returns allocations per query */
+    template<typename QueryFuncType>
+    double MeasureAllocationsPerQuery(int32 NumQueries, double& OutMsPerQuery, QueryFuncType&& Query)
+    {
+        const FScopedAllocationCounter Counter;
+        const double StartTime = FPlatformTime::Seconds();
+        for (int32 i = 0; i < NumQueries; ++i)
+        {
+            Query(i);
+        }
+        const double EndTime = FPlatformTime::Seconds();
+        const int64 Allocations = Counter.GetAllocations();
+
+        OutMsPerQuery = NumQueries > 0 ? (EndTime - StartTime) * 1000.0 / NumQueries : 0.0;
+        return NumQueries > 0 ? (double)Allocations / NumQueries : 0.0;
+    }
+
+    /** Spawns ActorCount transient target points, times the three query styles, then cleans up */
+    void RunForActorCount(UWorld* World, int32 ActorCount, int32 NumQueries, float QueryRadius)
+    {
+        // Keep density constant (~25 actors per 10m cell) so sizes are comparable
+        const float HalfExtent = FMath::Sqrt((float)ActorCount / 25.f) * 1000.f * 0.5f;
+        FRandomStream Random(1337);
+
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        SpawnParams.ObjectFlags |= RF_Transient;
+
+        TArray<AActor*> SpawnedActors;
+        SpawnedActors.Reserve(ActorCount);
+
+        FSpatialHashGrid Grid(1000.f);
+        for (int32 i = 0; i < ActorCount; ++i)
+        {
+            const FVector Location(
+                Random.FRandRange(-HalfExtent, HalfExtent),
+                Random.FRandRange(-HalfExtent, HalfExtent),
+                0.f);
+
+            if (AActor* Actor = World->SpawnActor<ATargetPoint>(ATargetPoint::StaticClass(), FTransform(Location), SpawnParams))
+            {
+                SpawnedActors.Add(Actor);
+                Grid.RegisterActor(Actor);
+            }
+        }
+
+        // Pre-generate query points so the loops only measure the grid
+        TArray<FVector> QueryPoints;
+        QueryPoints.Reserve(NumQueries);
+        for (int32 i = 0; i < NumQueries; ++i)
+        {
+            QueryPoints.Add(FVector(Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent), 0.f));
+        }
+
+        // Warm up scratch capacity once, like a subsystem member would be after its first frame
+        TArray<AActor*> Scratch;
+        for (const FVector& Point : QueryPoints)
+        {
+            Scratch.Reset();
+            Grid.GetActorsInRadius(Point, QueryRadius, Scratch);
+        }
+
+        int32 VisitedCount = 0;
+        double LegacyMs = 0.0, ScratchMs = 0.0, VisitorMs = 0.0;
+
+        const double LegacyAllocs = MeasureAllocationsPerQuery(NumQueries, LegacyMs, [&](int32 i)
+        {
+            TArray<AActor*> Result = Grid.GetActorsInRadius(QueryPoints[i], QueryRadius);
+            VisitedCount += Result.Num();
+        });
+
+        const double ScratchAllocs = MeasureAllocationsPerQuery(NumQueries, ScratchMs, [&](int32 i)
+        {
+            Scratch.Reset();
+            VisitedCount += Grid.GetActorsInRadius(QueryPoints[i], QueryRadius, Scratch);
+        });
+
+        const double VisitorAllocs = MeasureAllocationsPerQuery(NumQueries, VisitorMs, [&](int32 i)
+        {
+            Grid.ForEachActorInRadius(QueryPoints[i], QueryRadius, [&VisitedCount](AActor*) { VisitedCount++; });
+        });
+
+        UE_LOG(LogTemp, Log, TEXT("[%6d actors] Legacy:  %.2f allocs/query  %.4f ms/query"), ActorCount, LegacyAllocs, LegacyMs);
+        UE_LOG(LogTemp, Log, TEXT("[%6d actors] Scratch: %.2f allocs/query  %.4f ms/query"), ActorCount, ScratchAllocs, ScratchMs);
+        UE_LOG(LogTemp, Log, TEXT("[%6d actors] Visitor: %.2f allocs/query  %.4f ms/query  (avg hits: %.1f)"),
+            ActorCount, VisitorAllocs, VisitorMs, NumQueries > 0 ? (float)VisitedCount / (3 * NumQueries) : 0.f);
+
+        Grid.Clear();
+        for (AActor* Actor : SpawnedActors)
+        {
+            if (IsValid(Actor))
+            {
+                Actor->Destroy();
+            }
         }
     }
-    
-    // Remove from reverse lookup
-    ActorToCell.Remove(WeakActor);
 }
+#endif // !UE_BUILD_SHIPPING
 
 // ============================================================================
 // CONSOLE COMMAND REGISTRATION
 // ============================================================================
 
-// Static storage for console commands and grid pointer
+// Static storage for console commands and the owning subsystem
 static TUniquePtr<FAutoConsoleCommand> PrintStatsCommand;
 static TUniquePtr<FAutoConsoleCommand> DebugDrawCommand;
 static TUniquePtr<FAutoConsoleCommand> EnableCommand;
 static TUniquePtr<FAutoConsoleCommand> DisableCommand;
-static FSpatialHashGrid* GlobalGridPtr = nullptr;
+#if !UE_BUILD_SHIPPING
+static TUniquePtr<FAutoConsoleCommand> BenchmarkCommand;
+#endif
 static UWorld* GlobalWorldPtr = nullptr;
 static UInteractionSubsystem* GlobalSubsystemPtr = nullptr;
 
+/** Resolved per command so a grid rebuilt by ConfigureSpatialGrid is picked up without re-registering */
+static FSpatialHashGrid* GetRegisteredGrid()
+{
+    return GlobalSubsystemPtr ? GlobalSubsystemPtr->GetSpatialGrid() : nullptr;
+}
+
 void FSpatialHashGrid::RegisterConsoleCommands(UInteractionSubsystem* Subsystem)
 {
     if (!Subsystem)
@@ -317,12 +584,11 @@ void FSpatialHashGrid::RegisterConsoleCommands(UInteractionSubsystem* Subsystem)
         return;
     }
     
-    // Store grid, world, and subsystem pointers for console commands to access
-    GlobalGridPtr = Subsystem->GetSpatialGrid();
+    // Store world and subsystem pointers for console commands to access
     GlobalWorldPtr = Subsystem->GetWorld();
     GlobalSubsystemPtr = Subsystem;
     
-    if (!GlobalGridPtr)
+    if (!GetRegisteredGrid())
     {
         UE_LOG(LogTemp, Warning, TEXT("Cannot register console commands: Spatial Grid not initialized"));
         return;
@@ -334,7 +600,8 @@ void FSpatialHashGrid::RegisterConsoleCommands(UInteractionSubsystem* Subsystem)
         TEXT("Prints statistics about the spatial hash grid (actor count, cell count, distribution)"),
         FConsoleCommandDelegate::CreateLambda([]()
         {
-            if (!GlobalGridPtr)
+            FSpatialHashGrid* Grid = GetRegisteredGrid();
+            if (!Grid)
             {
                 UE_LOG(LogTemp, Warning, TEXT("Spatial Grid not initialized!"));
                 return;
@@ -344,7 +611,7 @@ void FSpatialHashGrid::RegisterConsoleCommands(UInteractionSubsystem* Subsystem)
             UE_LOG(LogTemp, Log, TEXT("SPATIAL HASH GRID STATS"));
             UE_LOG(LogTemp, Log, TEXT("======================================="));
             
-            GlobalGridPtr->PrintGridStats();
+            Grid->PrintGridStats();
             
             UE_LOG(LogTemp, Log, TEXT("======================================="));
         })
@@ -356,7 +623,8 @@ void FSpatialHashGrid::RegisterConsoleCommands(UInteractionSubsystem* Subsystem)
         TEXT("Draws visual representation of the spatial hash grid. Usage: DebugDrawSpatialGrid [Duration=5.0]"),
         FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
         {
-            if (!GlobalGridPtr)
+            FSpatialHashGrid* Grid = GetRegisteredGrid();
+            if (!Grid)
             {
                 UE_LOG(LogTemp, Warning, TEXT("Spatial Grid not initialized!"));
                 return;
@@ -389,7 +657,7 @@ void FSpatialHashGrid::RegisterConsoleCommands(UInteractionSubsystem* Subsystem)
                 Duration, *CenterLocation.ToString());
             
             // Draw grid centered on player (5 cell radius = 50 meters from player)
-            GlobalGridPtr->DebugDrawGrid(GlobalWorldPtr, CenterLocation, 5, Duration);
+            Grid->DebugDrawGrid(GlobalWorldPtr, CenterLocation, 5, Duration);
         })
     );
     
@@ -427,19 +695,60 @@ void FSpatialHashGrid::RegisterConsoleCommands(UInteractionSubsystem* Subsystem)
         })
     );
     
-    UE_LOG(LogTemp, Log, TEXT("Spatial hash console commands registered: PrintSpatialGridStats, DebugDrawSpatialGrid, EnableSpatialHashing, DisableSpatialHashing"));
+#if !UE_BUILD_SHIPPING
+    // Register BenchmarkSpatialGridQueries command
+    BenchmarkCommand = MakeUnique<FAutoConsoleCommand>(
+        TEXT("BenchmarkSpatialGridQueries"),
+        TEXT("Counts heap allocations and time per radius query at 1k/10k/100k actors. Usage: BenchmarkSpatialGridQueries [Queries=1000] [Radius=500]"),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            if (!GlobalWorldPtr)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("No valid world found!"));
+                return;
+            }
+
+            const int32 NumQueries = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+            const float QueryRadius = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 500.f;
+
+            UE_LOG(LogTemp, Log, TEXT("======================================="));
+            UE_LOG(LogTemp, Log, TEXT("SPATIAL GRID QUERY BENCHMARK (%d queries, radius %.0f)"), NumQueries, QueryRadius);
+            UE_LOG(LogTemp, Log, TEXT("======================================="));
+
+            if (!SpatialHashGridBenchmark::FScopedAllocationCounter::IsAvailable())
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Allocation counters need a build with stats enabled, allocs/query will read 0"));
+            }
+
+            for (const int32 ActorCount : { 1000, 10000, 100000 })
+            {
+                SpatialHashGridBenchmark::RunForActorCount(GlobalWorldPtr, ActorCount, NumQueries, QueryRadius);
+            }
+
+            UE_LOG(LogTemp, Log, TEXT("======================================="));
+        })
+    );
+#endif
+
+    UE_LOG(LogTemp, Log, TEXT("Spatial hash console commands registered: PrintSpatialGridStats, DebugDrawSpatialGrid, EnableSpatialHashing, DisableSpatialHashing, BenchmarkSpatialGridQueries"));
 }
 
 void FSpatialHashGrid::UnregisterConsoleCommands()
 {
     // Only unregister if they exist
-    if (PrintStatsCommand.IsValid() || DebugDrawCommand.IsValid() || EnableCommand.IsValid() || DisableCommand.IsValid())
+    bool bAnyRegistered = PrintStatsCommand.IsValid() || DebugDrawCommand.IsValid() || EnableCommand.IsValid() || DisableCommand.IsValid();
+#if !UE_BUILD_SHIPPING
+    bAnyRegistered |= BenchmarkCommand.IsValid();
+#endif
+    if (bAnyRegistered)
     {
         PrintStatsCommand.Reset();
         DebugDrawCommand.Reset();
         EnableCommand.Reset();
         DisableCommand.Reset();
-        GlobalGridPtr = nullptr;
+#if !UE_BUILD_SHIPPING
+        BenchmarkCommand.Reset();
+#endif
         GlobalWorldPtr = nullptr;
         GlobalSubsystemPtr = nullptr;
         
@@ -60,7 +60,10 @@ public:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void PostInitProperties() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 	// ========================================================================
@@ -91,10 +94,12 @@ public:
 	
 	/** 
 	 * Enable spatial hash position updates for moving actors
+	 * Tracked owners are checked by the interaction subsystem's batched mover pass
+	 * (see UInteractionSubsystem::MovingInteractableUpdateInterval) - this component never ticks
 	 * Set TRUE for: NPCs, moving platforms, elevators, vehicles
 	 * Leave FALSE for: Static items, chests, doors, pickups
 	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interactable|Spatial Hash")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetTrackMovementForSpatialHash, Category = "Interactable|Spatial Hash")
 	bool bTrackMovementForSpatialHash = false;
 	
 	/** 
@@ -106,11 +111,19 @@ public:
 	float MovementThreshold = 100.f;
 	
 	/** 
-	 * How often to check for movement (in seconds)
-	 * 0 = every frame, 0.1 = 10 times per second, 0.2 = 5 times per second
+	 * Seconds between this actor's checks in the batched mover pass
+	 * 0 = use UInteractionSubsystem::MovingInteractableUpdateInterval
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interactable|Spatial Hash", meta = (EditCondition = "bTrackMovementForSpatialHash", ClampMin = "0.0", ClampMax = "1.0"))
-	float MovementCheckInterval = 0.1f;
+	float MovementUpdateInterval = 0.f;
+	
+	/** Moved into MovementUpdateInterval on load (negative = never set, the subsystem's interval applies) */
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Use MovementUpdateInterval."))
+	float MovementCheckInterval_DEPRECATED = -1.f;
+	
+	/** Start or stop batched movement tracking; takes effect immediately after BeginPlay */
+	UFUNCTION(BlueprintSetter)
+	void SetTrackMovementForSpatialHash(bool bEnable);
 	
 	/**
 	 * Auto-detect if this actor is likely to move (checks for movement components)
@@ -235,17 +248,14 @@ protected:
 	// SPATIAL HASH MOVEMENT TRACKING - NEW
 	// ========================================================================
 	
-	/** Last known location for movement detection */
+	/** Last known location, passed to the grid on forced updates */
 	FVector LastKnownLocation;
 	
-	/** Time accumulator for movement checks */
-	float MovementCheckTimeAccumulator;
-	
-	/** Update spatial grid if actor has moved significantly */
-	void UpdateSpatialGridPosition();
-	
 	/** Check if owner has movement-related components */
 	bool HasMovementComponents() const;
+	
+	/** Re-register the owner with the batched mover pass using the current tracking settings (after BeginPlay only) */
+	void RefreshMovementTracking();
 
 	// ========================================================================
 	// HELPERS
@@ -90,10 +90,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Interaction | Spatial Hash")
 	TArray<AActor*> GetNearbyInteractables(const FVector& Location, float Radius = 1000.f) const;
 	
+	/** Zero-allocation variant: appends into caller-owned storage (caller Resets it), returns number appended */
+	int32 GetNearbyInteractables(const FVector& Location, float Radius, TArray<AActor*>& OutActors) const;
+	
+	/** Visit nearby interactables without collecting them (spatial hash only, falls back to brute force) */
+	template<typename FuncType>
+	void ForEachNearbyInteractable(const FVector& Location, float Radius, FuncType&& Visitor) const;
+	
 	/** Notify spatial grid that an actor has moved (call only for dynamic actors) */
 	UFUNCTION(BlueprintCallable, Category = "Interaction | Spatial Hash")
 	void NotifyActorMoved(AActor* Actor, const FVector& OldLocation);
 	
+	/**
+	 * Track a moving interactable in the batched mover pass (replaces per-component movement ticks)
+	 * @param UpdateInterval - Seconds between this mover's checks (0 = MovingInteractableUpdateInterval)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Interaction | Spatial Hash")
+	void RegisterMovingInteractable(AActor* Actor, float MovementThreshold = 100.f, float UpdateInterval = 0.f);
+	
+	/** Stop tracking a moving interactable */
+	UFUNCTION(BlueprintCallable, Category = "Interaction | Spatial Hash")
+	void UnregisterMovingInteractable(AActor* Actor);
+	
 	/** Debug: Draw spatial grid visualization */
 	UFUNCTION(BlueprintCallable, Category = "Interaction | Spatial Hash | Debug")
 	void DebugDrawSpatialGrid(const FVector& Center, int32 Radius = 5);
@@ -101,6 +119,15 @@ public:
 	/** Debug: Print spatial grid statistics to log */
 	UFUNCTION(BlueprintCallable, Category = "Interaction | Spatial Hash | Debug")
 	void PrintSpatialGridStats();
+	
+	/**
+	 * Rebuild the spatial grid with a new cell layout and re-register all interactables.
+	 * Call from the level on BeginPlay to pick a layout per world.
+	 * @param CellSize - Horizontal cell size in world units
+	 * @param CellHeight - Vertical cell size; 0 = planar X/Y cells, > 0 = volumetric X/Y/Z cells (multi-storey levels)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Interaction | Spatial Hash")
+	void ConfigureSpatialGrid(float CellSize, float CellHeight);
 
 	/** Events for UI / outline */
 	UPROPERTY(BlueprintAssignable, Category="Interaction")
@@ -287,6 +314,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction | Performance | Spatial Hash", meta = (ClampMin = "500", ClampMax = "5000"))
 	float SpatialGridCellSize = 1000.f;
 	
+	/** Vertical cell size (0 = planar X/Y cells; > 0 = volumetric cells so stacked floors don't share buckets) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction | Performance | Spatial Hash", meta = (ClampMin = "0", ClampMax = "5000"))
+	float SpatialGridCellHeight = 0.f;
+	
+	/** How often the batched mover pass re-checks tracked moving interactables without their own interval (0 = every frame) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction | Performance | Spatial Hash", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float MovingInteractableUpdateInterval = 0.1f;
+	
 	/** How many surrounding cells to check (1 = 3x3 grid, 2 = 5x5 grid) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction | Performance | Spatial Hash", meta = (ClampMin = "1", ClampMax = "3"))
 	int32 SpatialQueryCellRadius = 1;
@@ -330,12 +365,51 @@ protected:
 	/** Spatial hash grid for optimized actor queries (10-40x faster!) */
 	TUniquePtr<FSpatialHashGrid> SpatialGrid;
 	
+	// ========================================================================
+	// BATCHED MOVER PASS
+	// ========================================================================
+	
+	/** Tracked movers as parallel arrays, so the per-frame distance pass walks contiguous memory */
+	TArray<TWeakObjectPtr<AActor>> TrackedMovers;
+	TArray<TObjectKey<AActor>> TrackedMoverKeys;
+	TArray<FVector> TrackedMoverLastLocations;
+	TArray<float> TrackedMoverThresholdsSq;
+	
+	/** Per-mover interval (0 = MovingInteractableUpdateInterval) and time since that mover was last checked */
+	TArray<float> TrackedMoverIntervals;
+	TArray<float> TrackedMoverElapsed;
+	
+	/** Shortest per-mover interval (MAX_flt if none) - the pass itself runs no less often than this */
+	float ShortestTrackedMoverInterval = MAX_flt;
+	
+	/** Actor -> index into the tracked mover arrays (for O(1) unregister) */
+	TMap<TObjectKey<AActor>, int32> TrackedMoverIndices;
+	
+	/** Time accumulator for the batched mover pass */
+	float MovingInteractableTimeAccumulator = 0.f;
+	
+	/** Re-bin every tracked mover that moved further than its threshold since the last re-bin */
+	void TickMovingInteractables(float DeltaTime);
+	
+	/** Swap-remove a tracked mover, keeping the index map in sync */
+	void RemoveTrackedMoverAt(int32 Index);
+	
 	// Internal helper to perform interaction logic
 	bool PerformInteraction(AController* InstigatorController);
 
 	/** Track focused actor per pawn */
 	TMap<TWeakObjectPtr<APawn>, TWeakObjectPtr<AActor>> FocusedActors;
 
+	// ========================================================================
+	// QUERY SCRATCH STORAGE (reused every focus update - no per-query allocation)
+	// ========================================================================
+	
+	mutable TArray<AActor*> CandidateScratch;
+	mutable TArray<AActor*> HitCandidateScratch;
+	mutable TArray<AActor*> PriorityCandidateScratch;
+	mutable TArray<FHitResult> HitResultScratch;
+	TArray<APawn*> LocalPawnsScratch;
+
 	// ========================================================================
 	// ASYNC TRACE INTERNALS
 	// ========================================================================
@@ -429,21 +503,46 @@ protected:
 	// ASYNC AI PROCESSING INTERNALS
 	// ========================================================================
 	
+	/**
+	 * Immutable per-item snapshot captured on the game thread.
+	 * The worker only reads Location/TagPriority and writes DistanceSquared -
+	 * the weak pointer is carried through untouched and resolved back on the game thread.
+	 */
+	struct FAIPriorityItemSnapshot
+	{
+		TWeakObjectPtr<AActor> Item;
+		FVector Location = FVector::ZeroVector;
+		int32 TagPriority = 0;
+		float DistanceSquared = 0.f;
+	};
+	
 	/** Data structure for AI processing on background thread */
 	struct FAIPriorityData
 	{
 		TWeakObjectPtr<APawn> Pawn;
 		FVector PawnLocation;
-		TArray<TPair<TWeakObjectPtr<AActor>, float>> ItemsWithDistances; // Item + DistanceSquared
+		TArray<FAIPriorityItemSnapshot> Items; // Sorted closest-first by the worker
 		
 		FAIPriorityData() : PawnLocation(FVector::ZeroVector) {}
 	};
 	
+	/** Score one pawn's snapshot (worker thread - plain data only, no UObject access) */
+	static void ScoreAIPrioritySnapshot(FAIPriorityData& Data);
+	
 	/** Callback when AI priority calculations complete */
 	void OnAIPriorityCalculationsComplete(TArray<FAIPriorityData> ProcessedData);
 	
 	/** Helper: Apply load/unload to items based on new priority order */
-	void ApplyAIItemLoadState(APawn* Pawn, const TArray<TPair<TWeakObjectPtr<AActor>, float>>& SortedItems);
+	void ApplyAIItemLoadState(APawn* Pawn, const TArray<FAIPriorityItemSnapshot>& SortedItems);
+	
+	/**
+	 * Bumped whenever in-flight AI priority jobs must be discarded (timer stop, teardown).
+	 * Jobs remember the generation they were launched under and are dropped on mismatch.
+	 */
+	uint32 AIPriorityJobGeneration = 0;
+	
+	/** True while a priority job is running; new ticks are skipped instead of queuing behind it */
+	bool bAIPriorityJobInFlight = false;
 
 	// ========================================================================
 	// SERVER-SIDE VALIDATION (For Listen Server with Clients)
@@ -538,4 +637,26 @@ protected:
 
 	
 
-};
\ No newline at end of file
+};
+
+template<typename FuncType>
+void UInteractionSubsystem::ForEachNearbyInteractable(const FVector& Location, float Radius, FuncType&& Visitor) const
+{
+	if (bUseSpatialHashing && SpatialGrid)
+	{
+		SpatialGrid->ForEachActorInRadius(Location, Radius, Forward<FuncType>(Visitor));
+		return;
+	}
+
+	const float RadiusSq = Radius * Radius;
+	for (const TWeakObjectPtr<AActor>& WeakActor : Interactables)
+	{
+		if (AActor* Actor = WeakActor.Get())
+		{
+			if (FVector::DistSquared(Location, Actor->GetActorLocation()) <= RadiusSq)
+			{
+				Visitor(Actor);
+			}
+		}
+	}
+}
@@ -6,22 +6,37 @@
 
 #include "CoreMinimal.h"
 #include "Containers/Map.h"
-#include "Math/IntPoint.h"
+#include "Math/IntVector.h"
+#include "UObject/ObjectKey.h"
 
 // Forward declaration to avoid circular dependency
 class UInteractionSubsystem;
 
 /**
- * Fast 2D spatial hash grid for mostly-flat game worlds
+ * Fast spatial hash grid for mostly-flat game worlds
  * Better than octrees for Fortnite-style games with limited vertical gameplay
- * 
- * Performance: O(1) insertion, O(1) queries for nearby actors
- * Memory: ~24 bytes per grid cell + actor references
+ *
+ * Cell modes:
+ * - Planar (CellHeight <= 0, default): cells are X/Y columns, Z is ignored for bucketing
+ * - Volumetric (CellHeight > 0): cells are X/Y/Z boxes, so stacked floors of
+ *   multi-storey interiors and vertical stations land in separate buckets
+ *
+ * Storage layout (flat engine):
+ * - Cells live in an open-addressed table (linear probing, power-of-two capacity),
+ *   so a cell lookup is one hash + a short probe over a contiguous array
+ * - Each cell owns a dense array of 16-byte records (handle + cached position),
+ *   so radius tests never touch the actor
+ * - Every registered actor gets a stable handle into the entry array; the weak
+ *   pointer is only resolved for records that pass the distance test
+ * - Moving between cells is a swap-remove from the old cell + append to the new one
+ *
+ * Performance: O(1) insertion/removal/update, O(cells + records) queries
+ * Memory: ~40 bytes per cell slot + ~48 bytes per actor
  */
 class MODULARINTERACTIONSYSTEM_API FSpatialHashGrid
 {
 public:
-    FSpatialHashGrid(float InCellSize = 1000.f);
+    FSpatialHashGrid(float InCellSize = 1000.f, float InCellHeight = 0.f);
     ~FSpatialHashGrid();
 
     // Core Operations
@@ -30,57 +45,208 @@ public:
     void UpdateActorPosition(AActor* Actor, const FVector& OldLocation);
     void Clear();
 
-    // Query Operations
+    // Query Operations (allocate a fresh result array - convenient, not for hot paths)
     TArray<AActor*> GetNearbyActors(const FVector& Location, int32 CellRadius = 1) const;
     TArray<AActor*> GetActorsInRadius(const FVector& Center, float Radius) const;
     TArray<AActor*> GetActorsInCell(const FVector& Location) const;
 
+    // Zero-allocation queries: append into caller-owned scratch storage, return number appended.
+    // Callers Reset() the array between queries so its capacity is reused.
+    int32 GetNearbyActors(const FVector& Location, int32 CellRadius, TArray<AActor*>& OutActors) const;
+    int32 GetActorsInRadius(const FVector& Center, float Radius, TArray<AActor*>& OutActors) const;
+    int32 GetActorsInCell(const FVector& Location, TArray<AActor*>& OutActors) const;
+
+    // Visitor queries: Visitor(AActor*) is called for each live actor, nothing is collected
+    template<typename FuncType> void ForEachNearbyActor(const FVector& Location, int32 CellRadius, FuncType&& Visitor) const;
+    template<typename FuncType> void ForEachActorInRadius(const FVector& Center, float Radius, FuncType&& Visitor) const;
+    template<typename FuncType> void ForEachActorInCell(const FVector& Location, FuncType&& Visitor) const;
+
     // Utilities
-    int32 GetTotalActorCount() const;
-    int32 GetCellCount() const;
+    int32 GetTotalActorCount() const { return NumActiveEntries; }
+    int32 GetCellCount() const { return NumOccupiedCells; }
     float GetCellSize() const { return CellSize; }
+    float GetCellHeight() const { return CellHeight; }
+    bool IsVolumetric() const { return CellHeight > 0.f; }
 
     // Debug
     void DebugDrawGrid(UWorld* World, const FVector& Center, int32 Radius = 5, float Duration = 1.f) const;
     void PrintGridStats() const;
-    
+
     // Console command registration (called by owning subsystem)
     static void RegisterConsoleCommands(UInteractionSubsystem* Subsystem);
     static void UnregisterConsoleCommands();
 
 private:
+    /** Dense per-cell record: everything a radius test needs, nothing more (16 bytes) */
+    struct FCellRecord
+    {
+        int32 Handle;
+        FVector3f Position;
+    };
+
+    /** One slot of the open-addressed cell table */
+    struct FCellSlot
+    {
+        FIntVector Key = FIntVector::ZeroValue;
+        bool bUsed = false;
+        TArray<FCellRecord> Records;
+    };
+
+    /** Stable per-actor entry, addressed by handle */
+    struct FGridEntry
+    {
+        TWeakObjectPtr<AActor> Actor;
+        int32 SlotIndex = INDEX_NONE;   // Cell slot the actor lives in (INDEX_NONE = free entry)
+        int32 RecordIndex = INDEX_NONE; // Index into that cell's Records
+    };
+
     // Grid cell size in world units (Fortnite uses ~1000.0 = 10 meters)
     float CellSize;
+    float InvCellSize;
+
+    // Vertical cell size for volumetric mode (<= 0 = planar mode, every cell has Z = 0)
+    float CellHeight;
+    float InvCellHeight;
+
+    // Open-addressed cell table (capacity is always a power of two)
+    TArray<FCellSlot> CellSlots;
+    int32 NumUsedSlots = 0;
+    int32 NumOccupiedCells = 0;
 
-    // Main storage: Grid coordinate -> Array of actors in that cell
-    TMap<FIntPoint, TArray<TWeakObjectPtr<AActor>>> Grid;
+    // Handle -> entry; freed handles are recycled through FreeHandles
+    TArray<FGridEntry> Entries;
+    TArray<int32> FreeHandles;
+    int32 NumActiveEntries = 0;
 
-    // Reverse lookup: Actor -> Grid coordinate (for fast updates/removal)
-    TMap<TWeakObjectPtr<AActor>, FIntPoint> ActorToCell;
+    // Reverse lookup: Actor -> handle (TObjectKey hashes without resolving the weak pointer)
+    TMap<TObjectKey<AActor>, int32> ActorToHandle;
 
     // Conversion helpers
-    FORCEINLINE FIntPoint WorldToGrid(const FVector& WorldLocation) const;
-    FORCEINLINE FVector GridToWorld(const FIntPoint& GridCoord) const;
-    
+    FORCEINLINE FIntVector WorldToGrid(const FVector& WorldLocation) const;
+    FORCEINLINE FVector GridToWorld(const FIntVector& GridCoord) const;
+    FORCEINLINE int32 GetVerticalCellRadius(float Radius) const;
+
+    // Cell table helpers
+    static FORCEINLINE uint32 HashCell(const FIntVector& Cell);
+    int32 FindSlot(const FIntVector& Cell) const;
+    int32 FindOrAddSlot(const FIntVector& Cell);
+    void RehashCellTable(int32 NewCapacity);
+    const TArray<FCellRecord>* FindCellRecords(const FIntVector& Cell) const;
+
     // Internal helpers
-    void AddActorToCell(AActor* Actor, const FIntPoint& Cell);
-    void RemoveActorFromCell(AActor* Actor, const FIntPoint& Cell);
+    int32 AllocateHandle();
+    void AddRecordToCell(int32 Handle, const FIntVector& Cell, const FVector& Location);
+    void RemoveRecordFromCell(int32 Handle);
 };
 
 // Inline implementations for performance
-FORCEINLINE FIntPoint FSpatialHashGrid::WorldToGrid(const FVector& WorldLocation) const
+FORCEINLINE FIntVector FSpatialHashGrid::WorldToGrid(const FVector& WorldLocation) const
 {
-    return FIntPoint(
-        FMath::FloorToInt(WorldLocation.X / CellSize),
-        FMath::FloorToInt(WorldLocation.Y / CellSize)
+    return FIntVector(
+        FMath::FloorToInt(WorldLocation.X * InvCellSize),
+        FMath::FloorToInt(WorldLocation.Y * InvCellSize),
+        CellHeight > 0.f ? FMath::FloorToInt(WorldLocation.Z * InvCellHeight) : 0
     );
 }
 
-FORCEINLINE FVector FSpatialHashGrid::GridToWorld(const FIntPoint& GridCoord) const
+FORCEINLINE FVector FSpatialHashGrid::GridToWorld(const FIntVector& GridCoord) const
 {
     return FVector(
         GridCoord.X * CellSize + CellSize * 0.5f,
         GridCoord.Y * CellSize + CellSize * 0.5f,
-        0.f
+        CellHeight > 0.f ? GridCoord.Z * CellHeight : 0.f
     );
-}
\ No newline at end of file
+}
+
+FORCEINLINE int32 FSpatialHashGrid::GetVerticalCellRadius(float Radius) const
+{
+    // Planar mode has a single Z layer
+    return CellHeight > 0.f ? FMath::CeilToInt(Radius * InvCellHeight) : 0;
+}
+
+FORCEINLINE uint32 FSpatialHashGrid::HashCell(const FIntVector& Cell)
+{
+    // Large-prime mix (Teschner et al.) - neighbouring cells spread across the table
+    return (static_cast<uint32>(Cell.X) * 73856093u)
+        ^ (static_cast<uint32>(Cell.Y) * 19349663u)
+        ^ (static_cast<uint32>(Cell.Z) * 83492791u);
+}
+
+// Visitor query implementations (templated, so they live in the header)
+template<typename FuncType>
+void FSpatialHashGrid::ForEachNearbyActor(const FVector& Location, int32 CellRadius, FuncType&& Visitor) const
+{
+    const FIntVector CenterCell = WorldToGrid(Location);
+    const int32 CellRadiusZ = IsVolumetric() ? CellRadius : 0;
+
+    for (int32 Z = -CellRadiusZ; Z <= CellRadiusZ; Z++)
+    {
+        for (int32 X = -CellRadius; X <= CellRadius; X++)
+        {
+            for (int32 Y = -CellRadius; Y <= CellRadius; Y++)
+            {
+                if (const TArray<FCellRecord>* Records = FindCellRecords(CenterCell + FIntVector(X, Y, Z)))
+                {
+                    for (const FCellRecord& Record : *Records)
+                    {
+                        if (AActor* Actor = Entries[Record.Handle].Actor.Get())
+                        {
+                            Visitor(Actor);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+template<typename FuncType>
+void FSpatialHashGrid::ForEachActorInRadius(const FVector& Center, float Radius, FuncType&& Visitor) const
+{
+    const int32 CellRadius = FMath::CeilToInt(Radius * InvCellSize);
+    const int32 CellRadiusZ = GetVerticalCellRadius(Radius);
+    const float RadiusSq = Radius * Radius;
+    const FVector3f Center3f(Center);
+    const FIntVector CenterCell = WorldToGrid(Center);
+
+    // Volumetric mode only visits the floors the sphere actually reaches
+    for (int32 Z = -CellRadiusZ; Z <= CellRadiusZ; Z++)
+    {
+        for (int32 X = -CellRadius; X <= CellRadius; X++)
+        {
+            for (int32 Y = -CellRadius; Y <= CellRadius; Y++)
+            {
+                if (const TArray<FCellRecord>* Records = FindCellRecords(CenterCell + FIntVector(X, Y, Z)))
+                {
+                    for (const FCellRecord& Record : *Records)
+                    {
+                        // Distance check against cached position - no actor dereference
+                        if (FVector3f::DistSquared(Center3f, Record.Position) > RadiusSq)
+                            continue;
+
+                        // Only resolve the weak pointer for actual hits
+                        if (AActor* Actor = Entries[Record.Handle].Actor.Get())
+                        {
+                            Visitor(Actor);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+template<typename FuncType>
+void FSpatialHashGrid::ForEachActorInCell(const FVector& Location, FuncType&& Visitor) const
+{
+    if (const TArray<FCellRecord>* Records = FindCellRecords(WorldToGrid(Location)))
+    {
+        for (const FCellRecord& Record : *Records)
+        {
+            if (AActor* Actor = Entries[Record.Handle].Actor.Get())
+            {
+                Visitor(Actor);
+            }
+        }
+    }
+}
@@ -28,6 +28,7 @@ public class ModularInventorySystem : ModuleRules
 				"Core",
 				"CoreUObject",
 				"Engine",
+				"NetCore",
 				"UMG",
 				"Slate",
 				"SlateCore",
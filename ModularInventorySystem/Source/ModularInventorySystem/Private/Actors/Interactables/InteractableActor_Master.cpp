@@ -1812,5 +1812,5 @@ bool AInteractableActor_Master::LoadActorWithComponents(const FActorSaveEnvelope
 
 void AInteractableActor_Master::MarkSaveDirty()
 {
-	bSaveDirty = true;
+	USaveableRegistrySubsystem::PushDirty(this, bSaveDirty);
 }
@@ -21,6 +21,8 @@ UInventoryComponent::UInventoryComponent()
 {
     PrimaryComponentTick.bCanEverTick = false;
     SetIsReplicatedByDefault(true);
+    
+    ReplicatedInventory.OwnerComponent = this;
 }
 
 void UInventoryComponent::BeginPlay()
@@ -36,6 +38,8 @@ void UInventoryComponent::BeginPlay()
             Slot.Clear();
         }
         
+        NotifyAllSlotsWritten();
+        
         UE_LOG(LogInventoryInteractableSystem, Log, TEXT("InventoryComponent initialized: %d slots"), MaxInventorySlots);
     }
 
@@ -57,7 +61,7 @@ void UInventoryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 void UInventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME_CONDITION(UInventoryComponent, Inventory, COND_OwnerOnly);
+    DOREPLIFETIME_CONDITION(UInventoryComponent, ReplicatedInventory, COND_OwnerOnly);
 }
 
 // ============================================================================
@@ -145,6 +149,203 @@ void UInventoryComponent::OnRep_Inventory()
     MarkSaveDirty();
 }
 
+void UInventoryComponent::MarkSlotDirtyForReplication(int32 SlotIndex)
+{
+    if (!GetOwner() || !GetOwner()->HasAuthority() || !Inventory.IsValidIndex(SlotIndex))
+    {
+        return;
+    }
+    
+    ReplicatedInventory.SetSlot(SlotIndex, Inventory[SlotIndex]);
+}
+
+void UInventoryComponent::MarkAllSlotsDirtyForReplication()
+{
+    if (!GetOwner() || !GetOwner()->HasAuthority())
+    {
+        return;
+    }
+    
+    ReplicatedInventory.Rebuild(Inventory);
+}
+
+void UInventoryComponent::HandleReplicatedSlotChanged(int32 SlotIndex, const FInventorySlot& Slot)
+{
+    if (SlotIndex < 0)
+    {
+        return;
+    }
+    
+    // Every entry of the bunch is already deserialized - size for all of them at once
+    // so initial replication grows the array and rebuilds the indexes a single time
+    if (!Inventory.IsValidIndex(SlotIndex))
+    {
+        int32 RequiredSlots = SlotIndex + 1;
+        for (const FInventorySlotEntry& Entry : ReplicatedInventory.Entries)
+        {
+            RequiredSlots = FMath::Max(RequiredSlots, Entry.SlotIndex + 1);
+        }
+        
+        Inventory.SetNum(RequiredSlots);
+        RebuildSlotIndexes();
+    }
+    
+    Inventory[SlotIndex] = Slot;
+    ReindexSlot(SlotIndex);
+    bReplicatedSlotsChanged = true;
+    
+    // Only the touched slot's widget refreshes
+    OnInventorySlotChanged.Broadcast(FWWTagLibrary::Inventory_Type_PlayerInventory(), SlotIndex);
+}
+
+void UInventoryComponent::HandleReplicatedSlotRemoved(int32 SlotIndex)
+{
+    if (!Inventory.IsValidIndex(SlotIndex))
+    {
+        return;
+    }
+    
+    Inventory[SlotIndex].Clear();
+    ReindexSlot(SlotIndex);
+    bReplicatedSlotsChanged = true;
+    bReplicatedSlotsRemoved = true;
+    
+    OnInventorySlotChanged.Broadcast(FWWTagLibrary::Inventory_Type_PlayerInventory(), SlotIndex);
+}
+
+void UInventoryComponent::FlushReplicatedSlotChanges()
+{
+    if (!bReplicatedSlotsChanged)
+    {
+        return;
+    }
+    
+    bReplicatedSlotsChanged = false;
+    
+    // The server only removes entries when the inventory shrinks; by now they are gone from
+    // Entries, so the highest surviving SlotIndex is the new size
+    if (bReplicatedSlotsRemoved)
+    {
+        bReplicatedSlotsRemoved = false;
+        
+        int32 RequiredSlots = 0;
+        for (const FInventorySlotEntry& Entry : ReplicatedInventory.Entries)
+        {
+            RequiredSlots = FMath::Max(RequiredSlots, Entry.SlotIndex + 1);
+        }
+        
+        if (RequiredSlots < Inventory.Num())
+        {
+            Inventory.SetNum(RequiredSlots);
+            RebuildSlotIndexes();
+        }
+    }
+    
+    OnRep_Inventory();
+}
+
+// ============================================================================
+// SLOT INDEXES
+// ============================================================================
+
+void UInventoryComponent::NotifySlotWritten(int32 SlotIndex)
+{
+    ReindexSlot(SlotIndex);
+    MarkSlotDirtyForReplication(SlotIndex);
+}
+
+void UInventoryComponent::NotifyAllSlotsWritten()
+{
+    RebuildSlotIndexes();
+    MarkAllSlotsDirtyForReplication();
+}
+
+void UInventoryComponent::ReindexSlot(int32 SlotIndex)
+{
+    if (!Inventory.IsValidIndex(SlotIndex))
+    {
+        return;
+    }
+    
+    // Array changed size behind our back (client growth, save load) - cheaper to start over
+    if (IndexedSlots.Num() != Inventory.Num())
+    {
+        RebuildSlotIndexes();
+        return;
+    }
+    
+    SlotRevision++;
+    
+    FInventoryIndexedSlot& Indexed = IndexedSlots[SlotIndex];
+    const FInventorySlot& Slot = Inventory[SlotIndex];
+    
+    // Subtract what the slot held when last indexed
+    if (!Indexed.ItemID.IsNone())
+    {
+        if (FInventoryItemSlotIndex* ItemEntry = ItemSlotIndex.Find(Indexed.ItemID))
+        {
+            ItemEntry->TotalCount -= Indexed.Quantity;
+            ItemEntry->SlotIndices.RemoveSingleSwap(SlotIndex, EAllowShrinking::No);
+            if (ItemEntry->SlotIndices.IsEmpty())
+            {
+                ItemSlotIndex.Remove(Indexed.ItemID);
+            }
+        }
+    }
+    
+    // Duplicate GUIDs (SetSlot copies) - only drop the mapping if it still points here
+    if (const int32* MappedSlot = InstanceSlotIndex.Find(Indexed.InstanceID))
+    {
+        if (*MappedSlot == SlotIndex)
+        {
+            InstanceSlotIndex.Remove(Indexed.InstanceID);
+        }
+    }
+    
+    // Add what it holds now
+    const bool bEmpty = Slot.IsEmpty();
+    const FName NewItemID = bEmpty ? NAME_None : Slot.ItemID;
+    if (Indexed.ItemID != NewItemID)
+    {
+        Indexed.Definition = FItemDefinitionHandle();
+    }
+    Indexed.ItemID = NewItemID;
+    Indexed.Quantity = bEmpty ? 0 : Slot.Quantity;
+    Indexed.InstanceID = Slot.InstanceID;
+    
+    if (!bEmpty)
+    {
+        FInventoryItemSlotIndex& ItemEntry = ItemSlotIndex.FindOrAdd(Slot.ItemID);
+        ItemEntry.TotalCount += Slot.Quantity;
+        ItemEntry.SlotIndices.Add(SlotIndex);
+    }
+    
+    if (Slot.InstanceID.IsValid())
+    {
+        InstanceSlotIndex.Add(Slot.InstanceID, SlotIndex);
+    }
+    
+    EmptySlotBits[SlotIndex] = bEmpty;
+}
+
+void UInventoryComponent::RebuildSlotIndexes()
+{
+    SlotRevision++;
+    
+    ItemSlotIndex.Reset();
+    InstanceSlotIndex.Reset();
+    InstanceSlotIndex.Reserve(Inventory.Num());
+    EmptySlotBits.Init(true, Inventory.Num());
+    IndexedSlots.Reset();
+    IndexedSlots.SetNum(Inventory.Num());
+    
+    // Walk backwards so the lowest slot wins on duplicate GUIDs, same as a forward linear scan
+    for (int32 i = Inventory.Num() - 1; i >= 0; --i)
+    {
+        ReindexSlot(i);
+    }
+}
+
 // ============================================================================
 // DATA ACCESS
 // ============================================================================
@@ -200,10 +401,8 @@ bool UInventoryComponent::GetItemData(FName ItemID, FItemData& OutItemData) cons
         return false;
     }
     
-    static const FString Context = TEXT("InventoryItemLookup");
-    FItemData* FoundData = ItemDataTable->FindRow<FItemData>(ItemID, Context);
-    
-    if (FoundData)
+    // Blueprint needs its own copy - native code should use FindItemDefinition
+    if (const FItemData* FoundData = FindItemDefinition(ItemID))
     {
         OutItemData = *FoundData;
         return true;
@@ -211,6 +410,75 @@ bool UInventoryComponent::GetItemData(FName ItemID, FItemData& OutItemData) cons
     return false;
 }
 
+const FItemData* UInventoryComponent::FindItemDefinition(FName ItemID) const
+{
+    if (!ItemDataTable || ItemID.IsNone())
+    {
+        return nullptr;
+    }
+    return FItemDefinitionCache::Get(ItemDataTable).Find(ItemID);
+}
+
+const FItemDefinitionHotData* UInventoryComponent::FindItemHotData(FName ItemID) const
+{
+    if (!ItemDataTable || ItemID.IsNone())
+    {
+        return nullptr;
+    }
+    return FItemDefinitionCache::Get(ItemDataTable).FindHotData(ItemID);
+}
+
+FItemDefinitionHandle UInventoryComponent::ResolveSlotDefinition(int32 SlotIndex, FItemDefinitionCache*& OutDefinitions) const
+{
+    OutDefinitions = nullptr;
+    if (!ItemDataTable || !Inventory.IsValidIndex(SlotIndex) || Inventory[SlotIndex].IsEmpty())
+    {
+        return FItemDefinitionHandle();
+    }
+    
+    OutDefinitions = &FItemDefinitionCache::Get(ItemDataTable);
+    OutDefinitions->EnsureBuilt();
+    
+    // Indexes not rebuilt yet after a resize - resolve by ID without caching
+    if (IndexedSlots.Num() != Inventory.Num())
+    {
+        return OutDefinitions->FindHandle(Inventory[SlotIndex].ItemID);
+    }
+    
+    const FInventoryIndexedSlot& Indexed = IndexedSlots[SlotIndex];
+    if (!Indexed.Definition.IsSet() || Indexed.Definition.Generation != OutDefinitions->GetGeneration())
+    {
+        Indexed.Definition = OutDefinitions->FindHandle(Indexed.ItemID);
+    }
+    return Indexed.Definition;
+}
+
+const FItemData* UInventoryComponent::FindSlotItemDefinition(FGameplayTag InInventoryTypeTag, int32 SlotIndex) const
+{
+    const TArray<FInventorySlot>* InventoryArray = GetInventoryArray(InInventoryTypeTag);
+    if (!InventoryArray || !InventoryArray->IsValidIndex(SlotIndex) || (*InventoryArray)[SlotIndex].IsEmpty())
+    {
+        return nullptr;
+    }
+    
+    // Only the player inventory has index-aligned handles
+    if (InventoryArray != &Inventory)
+    {
+        return FindItemDefinition((*InventoryArray)[SlotIndex].ItemID);
+    }
+    
+    FItemDefinitionCache* Definitions = nullptr;
+    const FItemDefinitionHandle Handle = ResolveSlotDefinition(SlotIndex, Definitions);
+    return Definitions ? Definitions->Resolve(Handle) : nullptr;
+}
+
+const FItemDefinitionHotData* UInventoryComponent::FindSlotHotData(int32 SlotIndex) const
+{
+    FItemDefinitionCache* Definitions = nullptr;
+    const FItemDefinitionHandle Handle = ResolveSlotDefinition(SlotIndex, Definitions);
+    return Definitions ? Definitions->ResolveHotData(Handle) : nullptr;
+}
+
 TArray<FInventorySlot>* UInventoryComponent::GetInventoryArray(FGameplayTag InInventoryTypeTag)
 {
     if (InInventoryTypeTag == FWWTagLibrary::Inventory_Type_PlayerInventory())
@@ -233,15 +501,8 @@ int32 UInventoryComponent::GetItemCountPure(FName ItemID) const
 {
     if (ItemID.IsNone()) return 0;
     
-    int32 TotalCount = 0;
-    for (const FInventorySlot& Slot : Inventory)
-    {
-        if (Slot.ItemID == ItemID)
-        {
-            TotalCount += Slot.Quantity;
-        }
-    }
-    return TotalCount;
+    const FInventoryItemSlotIndex* ItemEntry = ItemSlotIndex.Find(ItemID);
+    return ItemEntry ? ItemEntry->TotalCount : 0;
 }
 
 
@@ -259,28 +520,16 @@ bool UInventoryComponent::HasItem(FName ItemID, int32 MinQuantity) const
 int32 UInventoryComponent::FindEmptySlot(FGameplayTag InInventoryTypeTag) const
 {
     const TArray<FInventorySlot>* InventoryArray = GetInventoryArray(InInventoryTypeTag);
-    if (!InventoryArray) return INDEX_NONE;
+    if (InventoryArray != &Inventory) return INDEX_NONE;
     
-    for (int32 i = 0; i < InventoryArray->Num(); ++i)
-    {
-        if ((*InventoryArray)[i].IsEmpty())
-        {
-            return i;
-        }
-    }
-    return INDEX_NONE;
+    // Word-at-a-time scan of the empty bitmap, lowest slot first
+    return EmptySlotBits.Find(true);
 }
 
 int32 UInventoryComponent::FindSlotIndexByInstanceID(FGuid InstanceID) const
 {
-    for (int32 i = 0; i < Inventory.Num(); ++i)
-    {
-        if (Inventory[i].InstanceID == InstanceID)
-        {
-            return i;
-        }
-    }
-    return INDEX_NONE;
+    const int32* SlotIndex = InstanceSlotIndex.Find(InstanceID);
+    return SlotIndex ? *SlotIndex : INDEX_NONE;
 }
 
 bool UInventoryComponent::ValidateSlotIndex(FGameplayTag InInventoryTypeTag, int32 SlotIndex) const
@@ -293,20 +542,32 @@ bool UInventoryComponent::TryAutoStack(FName ItemID, int32& Quantity, float Qual
 {
     if (Quantity <= 0) return false;
     
-    FItemData ItemData;
-    if (!GetItemData(ItemID, ItemData) || ItemData.MaxStackSize <= 1) return false;
+    const FInventoryItemSlotIndex* ItemEntry = ItemSlotIndex.Find(ItemID);
+    if (!ItemEntry || ItemEntry->SlotIndices.IsEmpty()) return false;
+    
+    // Every slot in the entry holds ItemID - any of their handles gives the definition
+    const FItemDefinitionHotData* HotData = FindSlotHotData(ItemEntry->SlotIndices[0]);
+    if (!HotData || HotData->MaxStackSize <= 1) return false;
     
-    for (FInventorySlot& Slot : Inventory)
+    // Only this item's stacks, lowest slot first (NotifySlotWritten reshuffles the live list)
+    TArray<int32, TInlineAllocator<8>> CandidateSlots;
+    CandidateSlots.Append(ItemEntry->SlotIndices);
+    CandidateSlots.Sort();
+    
+    const int32 MaxStackSize = HotData->MaxStackSize;
+    for (const int32 i : CandidateSlots)
     {
+        FInventorySlot& Slot = Inventory[i];
         if (Slot.ItemID == ItemID && 
             FMath::Abs(Slot.Quality - Quality) < 0.01f &&
-            Slot.Quantity < ItemData.MaxStackSize)
+            Slot.Quantity < MaxStackSize)
         {
-            int32 SpaceAvailable = ItemData.MaxStackSize - Slot.Quantity;
+            int32 SpaceAvailable = MaxStackSize - Slot.Quantity;
             int32 ToAdd = FMath::Min(SpaceAvailable, Quantity);
             
             Slot.Quantity += ToAdd;
             Quantity -= ToAdd;
+            NotifySlotWritten(i);
             
             if (Quantity <= 0) return true;
         }
@@ -333,6 +594,11 @@ bool UInventoryComponent::TryConsumeItem(const FName& ItemID, int32& Quantity, i
 
 void UInventoryComponent::BroadcastSlotChange(FGameplayTag InInventoryTypeTag, int32 SlotIndex)
 {
+    if (GetInventoryArray(InInventoryTypeTag) == &Inventory)
+    {
+        NotifySlotWritten(SlotIndex);
+    }
+    
     OnInventorySlotChanged.Broadcast(InInventoryTypeTag, SlotIndex);
     OnInventoryChanged.Broadcast(InInventoryTypeTag);
 }
@@ -350,7 +616,7 @@ FItemPreviewData UInventoryComponent::GetItemPreviewData(int32 SlotIndex) const
     UDataTable* DT = UItemJsonReader::GetItemDataTable();
     if (!DT) return Preview;
     
-    const FItemData* ItemData = DT->FindRow<FItemData>(Slot.ItemID, TEXT("GetItemPreviewData"));
+    const FItemData* ItemData = FItemDefinitionCache::Get(DT).Find(Slot.ItemID);
     if (!ItemData) return Preview;
     
     // Populate preview
@@ -564,8 +830,9 @@ TArray<FStatComparisonEntry> UInventoryComponent::BuildStatComparison(const FInv
     UDataTable* DT = UItemJsonReader::GetItemDataTable();
     if (!DT) return Entries;
     
-    const FItemData* A = DT->FindRow<FItemData>(CurrentItem.ItemID, TEXT("Compare"));
-    const FItemData* B = DT->FindRow<FItemData>(CompareItem.ItemID, TEXT("Compare"));
+    FItemDefinitionCache& Definitions = FItemDefinitionCache::Get(DT);
+    const FItemData* A = Definitions.Find(CurrentItem.ItemID);
+    const FItemData* B = Definitions.Find(CompareItem.ItemID);
     if (!A || !B) return Entries;
     
     // Collect all stat keys from both items
@@ -699,8 +966,8 @@ bool UInventoryComponent::Internal_AddItem(FName ItemID, int32 Quantity, float Q
      */
     if (ItemID.IsNone() || Quantity <= 0) return false;
     
-    FItemData ItemData;
-    if (!GetItemData(ItemID, ItemData))
+    const FItemData* ItemData = FindItemDefinition(ItemID);
+    if (!ItemData)
     {
         UE_LOG(LogInventoryInteractableSystem, Warning, TEXT("AddItem failed - Invalid ItemID: %s"), *ItemID.ToString());
         return false;
@@ -721,12 +988,12 @@ bool UInventoryComponent::Internal_AddItem(FName ItemID, int32 Quantity, float Q
         FInventorySlot& Slot = Inventory[EmptySlot];
         Slot.InstanceID = FGuid::NewGuid();
         Slot.ItemID = ItemID;
-        Slot.Quantity = FMath::Min(RemainingQuantity, ItemData.MaxStackSize);
-        Slot.MaxStackSize = ItemData.MaxStackSize;
+        Slot.Quantity = FMath::Min(RemainingQuantity, ItemData->MaxStackSize);
+        Slot.MaxStackSize = ItemData->MaxStackSize;
         Slot.Quality = Quality;
         Slot.Durability = Durability;  // ← NEW
         Slot.bIsStolen = bIsStolen;
-        Slot.ItemTags = ItemData.BaseTags;
+        Slot.ItemTags = ItemData->BaseTags;
         
         RemainingQuantity -= Slot.Quantity;
         
@@ -741,24 +1008,23 @@ bool UInventoryComponent::Internal_AddItem(FName ItemID, int32 Quantity, float Q
 
 bool UInventoryComponent::Internal_RemoveItemByInstance(FGuid InstanceID, int32 Quantity)
 {
-    for (int32 i = 0; i < Inventory.Num(); ++i)
+    const int32 i = FindSlotIndexByInstanceID(InstanceID);
+    if (!Inventory.IsValidIndex(i))
     {
-        FInventorySlot& Slot = Inventory[i];
-        if (Slot.InstanceID == InstanceID)
-        {
-            FName ItemID = Slot.ItemID;
-            int32 RemovedQuantity = FMath::Min(Quantity, Slot.Quantity);
-            
-            Slot.Quantity -= RemovedQuantity;
-            if (Slot.Quantity <= 0) Slot.Clear();
-            
-            BroadcastSlotChange(FWWTagLibrary::Inventory_Type_PlayerInventory(), i);
-            OnItemRemoved.Broadcast(ItemID, RemovedQuantity, InstanceID);
-            MarkSaveDirty();
-            return true;
-        }
+        return false;
     }
-    return false;
+    
+    FInventorySlot& Slot = Inventory[i];
+    FName ItemID = Slot.ItemID;
+    int32 RemovedQuantity = FMath::Min(Quantity, Slot.Quantity);
+    
+    Slot.Quantity -= RemovedQuantity;
+    if (Slot.Quantity <= 0) Slot.Clear();
+    
+    BroadcastSlotChange(FWWTagLibrary::Inventory_Type_PlayerInventory(), i);
+    OnItemRemoved.Broadcast(ItemID, RemovedQuantity, InstanceID);
+    MarkSaveDirty();
+    return true;
 }
 
 bool UInventoryComponent::Internal_MoveItem(FGameplayTag SourceType, int32 SourceSlot, FGameplayTag DestType, int32 DestSlot)
@@ -877,14 +1143,12 @@ bool UInventoryComponent::Internal_DropItem(FGameplayTag InInventoryTypeTag, int
     //Spawn in the world
     if (UUniversalSpawnManager* SpawnManager = UUniversalSpawnManager::Get(this))
     {
-        FItemData ItemData;
-        
-        if (GetItemData(DroppedSlot.ItemID, ItemData))
+        if (const FItemData* ItemData = FindItemDefinition(DroppedSlot.ItemID))
         {
             SpawnManager->SpawnActor(
                 SpawnTransform.GetLocation(),
                 SpawnTransform.GetRotation().Rotator(),
-                ItemData.PickupActorClass,
+                ItemData->PickupActorClass,
                 DroppedSlot.ItemID,
                 DropQuantity,
                 DroppedSlot.Durability,
@@ -1037,6 +1301,14 @@ void UInventoryComponent::Internal_CombineSimilarItems(FGameplayTag InInventoryT
             TEXT("  Created stack in slot %d with quantity %d"), SlotIndex, QuantityForThisSlot);
     }
     
+    if (InventorySlots == &Inventory)
+    {
+        for (int32 SlotIndex : SimilarSlotIndices)
+        {
+            NotifySlotWritten(SlotIndex);
+        }
+    }
+    
     UE_LOG(LogInventoryInteractableSystem, Log, 
         TEXT("Combine complete! Used %d slots (freed %d slots)"),
         SlotsFilled, SimilarSlotIndices.Num() - SlotsFilled);
@@ -1048,8 +1320,17 @@ void UInventoryComponent::Internal_ConsumeItem(const FName& ItemID, int32 Quanti
 {
     int32 RemainingToConsume = Quantity;
     
-    for (FInventorySlot& Slot : Inventory)
+    // Copy - emptied slots drop out of the live list as they are written
+    TArray<int32, TInlineAllocator<8>> ItemSlots;
+    if (const FInventoryItemSlotIndex* ItemEntry = ItemSlotIndex.Find(ItemID))
     {
+        ItemSlots.Append(ItemEntry->SlotIndices);
+        ItemSlots.Sort();
+    }
+    
+    for (const int32 i : ItemSlots)
+    {
+        FInventorySlot& Slot = Inventory[i];
         if (Slot.ItemID != ItemID) continue;
         if (RemainingToConsume <= 0) break;
         
@@ -1061,6 +1342,8 @@ void UInventoryComponent::Internal_ConsumeItem(const FName& ItemID, int32 Quanti
         {
             Slot.Clear();
         }
+        
+        NotifySlotWritten(i);
     }
     
     OnItemConsumed.Broadcast(ItemID, Quantity);
@@ -1073,7 +1356,10 @@ bool UInventoryComponent::Internal_SetSlot(int32 Index, FInventorySlot& Slot)
     FInventorySlot OldSlot = Inventory[Index];
     Inventory[Index] = Slot;
 
-    BroadcastSlotChange(InventoryTypeTag, Index);
+    // Always writes Inventory, whatever InventoryTypeTag this component was configured with
+    NotifySlotWritten(Index);
+    OnInventorySlotChanged.Broadcast(InventoryTypeTag, Index);
+    OnInventoryChanged.Broadcast(InventoryTypeTag);
     return true;
 }
 
@@ -1227,13 +1513,10 @@ void UInventoryComponent::Server_CombineSimilarItems_Implementation(FGameplayTag
 
 bool UInventoryComponent::IsSlotEquippable(FGameplayTag InInventoryTypeTag, int32 SlotIndex) const
 {
-    FInventorySlot SlotData;
-    if (!GetSlot(InInventoryTypeTag, SlotIndex, SlotData) || SlotData.IsEmpty()) return false;
+    const FItemData* ItemData = FindSlotItemDefinition(InInventoryTypeTag, SlotIndex);
+    if (!ItemData) return false;
     
-    FItemData ItemData;
-    if (!GetItemData(SlotData.ItemID, ItemData)) return false;
-    
-    return ItemData.BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Behavior_Equip());
+    return ItemData->BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Behavior_Equip());
 }
 
 bool UInventoryComponent::IsSlotEquipped(FGameplayTag InInventoryTypeTag, int32 SlotIndex) const
@@ -1246,37 +1529,28 @@ bool UInventoryComponent::IsSlotEquipped(FGameplayTag InInventoryTypeTag, int32
 
 bool UInventoryComponent::IsSlotUsable(FGameplayTag InInventoryTypeTag, int32 SlotIndex) const
 {
-    FInventorySlot SlotData;
-    if (!GetSlot(InInventoryTypeTag, SlotIndex, SlotData) || SlotData.IsEmpty()) return false;
+    const FItemData* ItemData = FindSlotItemDefinition(InInventoryTypeTag, SlotIndex);
+    if (!ItemData) return false;
     
-    FItemData ItemData;
-    if (!GetItemData(SlotData.ItemID, ItemData)) return false;
-    
-    return ItemData.BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Behavior_Use()) ||
-           ItemData.BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Behavior_Consume()) ||
-           ItemData.BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Behavior_Activate());
+    return ItemData->BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Behavior_Use()) ||
+           ItemData->BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Behavior_Consume()) ||
+           ItemData->BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Behavior_Activate());
 }
 
 bool UInventoryComponent::IsSlotDroppable(FGameplayTag InInventoryTypeTag, int32 SlotIndex) const
 {
-    FInventorySlot SlotData;
-    if (!GetSlot(InInventoryTypeTag, SlotIndex, SlotData) || SlotData.IsEmpty()) return false;
+    const FItemData* ItemData = FindSlotItemDefinition(InInventoryTypeTag, SlotIndex);
+    if (!ItemData) return false;
     
-    FItemData ItemData;
-    if (!GetItemData(SlotData.ItemID, ItemData)) return false;
-    
-    return !ItemData.BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Flags_NoDrop());
+    return !ItemData->BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Flags_NoDrop());
 }
 
 bool UInventoryComponent::IsSlotAttachment(FGameplayTag InInventoryTypeTag, int32 SlotIndex) const
 {
-    FInventorySlot SlotData;
-    if (!GetSlot(InInventoryTypeTag, SlotIndex, SlotData) || SlotData.IsEmpty()) return false;
+    const FItemData* ItemData = FindSlotItemDefinition(InInventoryTypeTag, SlotIndex);
+    if (!ItemData) return false;
     
-    FItemData ItemData;
-    if (!GetItemData(SlotData.ItemID, ItemData)) return false;
-    
-    return ItemData.BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Type_Attachment());
+    return ItemData->BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Type_Attachment());
 }
 
 bool UInventoryComponent::IsSlotCombinable(FGameplayTag InInventoryTypeTag, int32 SlotIndex) const
@@ -1287,31 +1561,20 @@ bool UInventoryComponent::IsSlotCombinable(FGameplayTag InInventoryTypeTag, int3
 bool UInventoryComponent::CanAttachToSlot(FGameplayTag AttachmentInInventoryTypeTag, int32 AttachmentSlotIndex,
                                            FGameplayTag TargetInInventoryTypeTag, int32 TargetSlotIndex) const
 {
-    FInventorySlot AttachmentSlot;
-    if (!GetSlot(AttachmentInInventoryTypeTag, AttachmentSlotIndex, AttachmentSlot) || AttachmentSlot.IsEmpty())
-    {
-        return false;
-    }
-    
-    FInventorySlot TargetSlot;
-    if (!GetSlot(TargetInInventoryTypeTag, TargetSlotIndex, TargetSlot) || TargetSlot.IsEmpty())
-    {
-        return false;
-    }
-    
-    FItemData AttachmentData;
-    FItemData TargetData;
-    if (!GetItemData(AttachmentSlot.ItemID, AttachmentData) || !GetItemData(TargetSlot.ItemID, TargetData))
+    // Empty or invalid slots resolve to no definition
+    const FItemData* AttachmentData = FindSlotItemDefinition(AttachmentInInventoryTypeTag, AttachmentSlotIndex);
+    const FItemData* TargetData = FindSlotItemDefinition(TargetInInventoryTypeTag, TargetSlotIndex);
+    if (!AttachmentData || !TargetData)
     {
         return false;
     }
     
-    if (!AttachmentData.BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Type_Attachment()))
+    if (!AttachmentData->BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Type_Attachment()))
     {
         return false;
     }
     
-    if (!TargetData.BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Behavior_Equip()))
+    if (!TargetData->BaseTags.HasTag(FWWTagLibrary::Inventory_Item_Behavior_Equip()))
     {
         return false;
     }
@@ -1666,10 +1929,11 @@ void UInventoryComponent::ClearDirty_Implementation()
 
 void UInventoryComponent::OnSaveDataLoaded_Implementation()
 {
+    NotifyAllSlotsWritten();
     OnRep_Inventory();
 }
 
 void UInventoryComponent::MarkSaveDirty()
 {
-    bSaveDirty = true;
+    USaveableRegistrySubsystem::PushDirty(this, bSaveDirty);
 }
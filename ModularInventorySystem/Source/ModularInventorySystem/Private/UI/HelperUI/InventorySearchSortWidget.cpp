@@ -10,6 +10,8 @@
 #include "WW_TagLibrary.h"
 #include "Engine/DataTable.h"
 #include "Subsystems/InventoryWidgetManager.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
 
 UInventorySearchSortWidget::UInventorySearchSortWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -126,6 +128,7 @@ void UInventorySearchSortWidget::CacheSlotWidgets()
 void UInventorySearchSortWidget::CacheOriginalOrder()
 {
 	OriginalSlotOrder.Empty();
+	bSortKeysValid = false;
 	
 	for (int32 i = 0; i < AllSlotWidgets.Num(); ++i)
 	{
@@ -239,6 +242,16 @@ void UInventorySearchSortWidget::RefreshGridVisuals()
 	const FString SearchText = EditableText_SearchBar->GetText().ToString();
 	const bool bIsSearching = !SearchText.IsEmpty() && !SearchText.Equals(TEXT("Type..."), ESearchCase::IgnoreCase);
 
+	// One filter pass (usually served from the previous result) instead of a match per slot
+	TBitArray<> MatchingSlots(false, AllSlotWidgets.Num());
+	if (bIsSearching)
+	{
+		for (const int32 SlotIndex : FilterSlotsBySearch(SearchText))
+		{
+			MatchingSlots[SlotIndex] = true;
+		}
+	}
+
 	for (int32 i = 0; i < AllSlotWidgets.Num(); ++i)
 	{
 		UInventorySlotWidget* SlotWidget = AllSlotWidgets[i];
@@ -249,8 +262,7 @@ void UInventorySearchSortWidget::RefreshGridVisuals()
 
 		if (bIsSearching)
 		{
-			const bool bMatches = DoesSlotMatchSearch(i, SearchText);
-			SlotWidget->SetRenderOpacity(bMatches ? 1.0f : 0.3f);
+			SlotWidget->SetRenderOpacity(MatchingSlots[i] ? 1.0f : 0.3f);
 		}
 		else
 		{
@@ -287,43 +299,17 @@ void UInventorySearchSortWidget::OnSearchBarMouseButtonDown(const FGeometry& Geo
 }
 bool UInventorySearchSortWidget::DoesSlotMatchSearch(int32 SlotIndex, const FString& SearchTerm)
 {
-	FInventorySlot* InventorySlot = GetSlotData(SlotIndex);
-	if (!InventorySlot || InventorySlot->IsEmpty())
+	const TArray<FInventorySlot>* Slots = OwnerInventoryComp
+		? OwnerInventoryComp->GetInventoryArray(FWWTagLibrary::Inventory_Type_PlayerInventory())
+		: nullptr;
+	if (!Slots || !Slots->IsValidIndex(SlotIndex))
 	{
 		return false;
 	}
 
-	FItemData* ItemData = GetItemData(InventorySlot->ItemID);
-	if (!ItemData)
-	{
-		return false;
-	}
-
-	FString LowerSearch = SearchTerm.ToLower();
-	
-	if (ItemData->DisplayName.ToString().ToLower().Contains(LowerSearch))
-	{
-		return true;
-	}
-	
-	if (ItemData->Description.ToString().ToLower().Contains(LowerSearch))
-	{
-		return true;
-	}
-	
-	FGameplayTag TypeTag = GetTypeTag(ItemData);
-	if (TypeTag.IsValid() && TypeTag.ToString().ToLower().Contains(LowerSearch))
-	{
-		return true;
-	}
-	
-	FGameplayTag RarityTag = GetRarityTag(ItemData);
-	if (RarityTag.IsValid() && RarityTag.ToString().ToLower().Contains(LowerSearch))
-	{
-		return true;
-	}
-	
-	return false;
+	RefreshSearchIndexIfStale();
+	PrepareSearchQuery(SearchTerm);
+	return DoesSlotMatchPreparedQuery((*Slots)[SlotIndex]);
 }
 
 void UInventorySearchSortWidget::SetActiveSlot(UInventorySlotWidget* SlotWidget)
@@ -351,265 +337,263 @@ FInventorySlot* UInventorySearchSortWidget::GetSlotData(int32 SlotIndex)
 	return nullptr;
 }
 
-FItemData* UInventorySearchSortWidget::GetItemData(FName ItemID)
+const FItemData* UInventorySearchSortWidget::GetItemData(FName ItemID)
 {
-	static FItemData TempData;
-	if (OwnerInventoryComp && OwnerInventoryComp->GetItemData(ItemID, TempData))
-	{
-		return &TempData;
-	}
-	return nullptr;
+	// Shared definition row - no copy, and two lookups in one comparator no longer alias
+	return OwnerInventoryComp ? OwnerInventoryComp->FindItemDefinition(ItemID) : nullptr;
 }
 
 void UInventorySearchSortWidget::SortByName(bool bAscending)
 {
-	if (!OwnerInventoryComp)
-	{
-		return;
-	}
-
-	TArray<int32> SlotsToSort;
-	for (int32 SlotIndex : OriginalSlotOrder)
-	{
-		FInventorySlot* InventorySlot = GetSlotData(SlotIndex);
-		if (InventorySlot && !InventorySlot->IsEmpty())
-		{
-			SlotsToSort.Add(SlotIndex);
-		}
-	}
+	SortSlotsBy(EInventorySortMode::Name, bAscending);
+}
 
-	SlotsToSort.Sort([this, bAscending](int32 A, int32 B)
-	{
-		FInventorySlot* SlotA = GetSlotData(A);
-		FInventorySlot* SlotB = GetSlotData(B);
-		
-		if (!SlotA || !SlotB) return false;
+void UInventorySearchSortWidget::SortByRarity(bool bAscending)
+{
+	SortSlotsBy(EInventorySortMode::Rarity, bAscending);
+}
 
-		FItemData* DataA = GetItemData(SlotA->ItemID);
-		FItemData* DataB = GetItemData(SlotB->ItemID);
-		
-		if (!DataA || !DataB) return false;
+void UInventorySearchSortWidget::SortByType(bool bAscending)
+{
+	SortSlotsBy(EInventorySortMode::Type, bAscending);
+}
 
-		FString NameA = DataA->DisplayName.ToString();
-		FString NameB = DataB->DisplayName.ToString();
+void UInventorySearchSortWidget::SortByWeight(bool bAscending)
+{
+	SortSlotsBy(EInventorySortMode::Weight, bAscending);
+}
 
-		return bAscending ? (NameA < NameB) : (NameA > NameB);
-	});
+void UInventorySearchSortWidget::SortByValue(bool bAscending)
+{
+	SortSlotsBy(EInventorySortMode::Value, bAscending);
+}
 
-	FilteredSlotIndices = SlotsToSort;
+void UInventorySearchSortWidget::SortByQuantity(bool bAscending)
+{
+	SortSlotsBy(EInventorySortMode::Quantity, bAscending);
 }
 
-void UInventorySearchSortWidget::SortByRarity(bool bAscending)
+void UInventorySearchSortWidget::SortSlotsBy(EInventorySortMode Mode, bool bAscending)
 {
 	if (!OwnerInventoryComp)
 	{
 		return;
 	}
 
-	TArray<int32> SlotsToSort;
-	for (int32 SlotIndex : OriginalSlotOrder)
+	InventorySortKeys::SortSlots(GetSortKeys(), Mode, bAscending, FilteredSlotIndices);
+}
+
+const TArray<FInventorySortKey>& UInventorySearchSortWidget::GetSortKeys()
+{
+	const TArray<FInventorySlot>* Slots = OwnerInventoryComp
+		? OwnerInventoryComp->GetInventoryArray(FWWTagLibrary::Inventory_Type_PlayerInventory())
+		: nullptr;
+	if (!Slots)
 	{
-		FInventorySlot* InventorySlot = GetSlotData(SlotIndex);
-		if (InventorySlot && !InventorySlot->IsEmpty())
-		{
-			SlotsToSort.Add(SlotIndex);
-		}
+		SortKeys.Reset();
+		bSortKeysValid = false;
+		return SortKeys;
 	}
 
-	SlotsToSort.Sort([this, bAscending](int32 A, int32 B)
+	const UDataTable* ItemTable = OwnerInventoryComp->ItemDataTable;
+	const uint32 SlotRevision = OwnerInventoryComp->GetSlotRevision();
+	const uint32 Generation = ItemTable ? FItemDefinitionCache::Get(ItemTable).GetGeneration() : 0;
+
+	// Re-sorting an unchanged inventory (switching modes, toggling direction) reuses the keys
+	if (!bSortKeysValid || SortKeysSlotRevision != SlotRevision || SortKeysGeneration != Generation)
 	{
-		FInventorySlot* SlotA = GetSlotData(A);
-		FInventorySlot* SlotB = GetSlotData(B);
-		
-		if (!SlotA || !SlotB) return false;
+		InventorySortKeys::BuildKeys(*Slots, OriginalSlotOrder, ItemTable, SortKeys);
+		SortKeysSlotRevision = SlotRevision;
+		SortKeysGeneration = Generation;
+		bSortKeysValid = true;
+	}
 
-		FItemData* DataA = GetItemData(SlotA->ItemID);
-		FItemData* DataB = GetItemData(SlotB->ItemID);
-		
-		if (!DataA || !DataB) return false;
+	return SortKeys;
+}
 
-		int32 RarityA = GetRaritySortValue(GetRarityTag(DataA));
-		int32 RarityB = GetRaritySortValue(GetRarityTag(DataB));
+void UInventorySearchSortWidget::SortBySearch()
+{
+	if (!EditableText_SearchBar)
+	{
+		return;
+	}
 
-		return bAscending ? (RarityA < RarityB) : (RarityA > RarityB);
-	});
+	const FString SearchText = EditableText_SearchBar->GetText().ToString();
+	FilteredSlotIndices = FilterSlotsBySearch(SearchText);
+}
 
-	FilteredSlotIndices = SlotsToSort;
+void UInventorySearchSortWidget::RestoreOriginalOrder()
+{
+	FilteredSlotIndices = OriginalSlotOrder;
 }
 
-void UInventorySearchSortWidget::SortByType(bool bAscending)
+void UInventorySearchSortWidget::ReorderGridVisually()
 {
-	if (!OwnerInventoryComp)
+	// Destiny 2-style: Keep slots in place, just dim non-matches
+	// Actual reordering would require recreating grid slots
+}
+
+TArray<int32> UInventorySearchSortWidget::FilterSlotsBySearch(const FString& SearchTerm)
+{
+	TArray<int32> MatchingSlots;
+
+	const TArray<FInventorySlot>* Slots = OwnerInventoryComp
+		? OwnerInventoryComp->GetInventoryArray(FWWTagLibrary::Inventory_Type_PlayerInventory())
+		: nullptr;
+	if (!Slots)
 	{
-		return;
+		return MatchingSlots;
 	}
 
-	TArray<int32> SlotsToSort;
-	for (int32 SlotIndex : OriginalSlotOrder)
+	RefreshSearchIndexIfStale();
+	PrepareSearchQuery(SearchTerm);
+
+	const int32 NumSlots = FMath::Min(AllSlotWidgets.Num(), Slots->Num());
+	const uint32 SlotRevision = OwnerInventoryComp->GetSlotRevision();
+
+	// Appending characters can only narrow the result - re-test just the previous matches
+	const bool bCanNarrow = bHasLastSearch &&
+		LastSearchSlotRevision == SlotRevision &&
+		SearchQueryScratch.StartsWith(LastSearchQuery, ESearchCase::CaseSensitive);
+
+	if (bCanNarrow)
 	{
-		FInventorySlot* InventorySlot = GetSlotData(SlotIndex);
-		if (InventorySlot && !InventorySlot->IsEmpty())
+		MatchingSlots.Reserve(LastSearchMatches.Num());
+		for (const int32 SlotIndex : LastSearchMatches)
 		{
-			SlotsToSort.Add(SlotIndex);
+			if (SlotIndex < NumSlots && DoesSlotMatchPreparedQuery((*Slots)[SlotIndex]))
+			{
+				MatchingSlots.Add(SlotIndex);
+			}
 		}
 	}
-
-	SlotsToSort.Sort([this, bAscending](int32 A, int32 B)
+	else
 	{
-		FInventorySlot* SlotA = GetSlotData(A);
-		FInventorySlot* SlotB = GetSlotData(B);
-		
-		if (!SlotA || !SlotB) return false;
-
-		FItemData* DataA = GetItemData(SlotA->ItemID);
-		FItemData* DataB = GetItemData(SlotB->ItemID);
-		
-		if (!DataA || !DataB) return false;
-
-		FString TypeA = GetTypeTag(DataA).ToString();
-		FString TypeB = GetTypeTag(DataB).ToString();
+		MatchingSlots.Reserve(NumSlots);
+		for (int32 i = 0; i < NumSlots; ++i)
+		{
+			if (DoesSlotMatchPreparedQuery((*Slots)[i]))
+			{
+				MatchingSlots.Add(i);
+			}
+		}
+	}
 
-		return bAscending ? (TypeA < TypeB) : (TypeA > TypeB);
-	});
+	LastSearchQuery.Reset();
+	LastSearchQuery.Append(SearchQueryScratch);
+	LastSearchMatches = MatchingSlots;
+	LastSearchSlotRevision = SlotRevision;
+	bHasLastSearch = true;
 
-	FilteredSlotIndices = SlotsToSort;
+	return MatchingSlots;
 }
 
-void UInventorySearchSortWidget::SortByWeight(bool bAscending)
+void UInventorySearchSortWidget::RefreshSearchIndexIfStale()
 {
-	if (!OwnerInventoryComp)
+	if (!OwnerInventoryComp || !OwnerInventoryComp->ItemDataTable)
 	{
 		return;
 	}
 
-	TArray<int32> SlotsToSort;
-	for (int32 SlotIndex : OriginalSlotOrder)
+	const uint32 Generation = FItemDefinitionCache::Get(OwnerInventoryComp->ItemDataTable).GetGeneration();
+	if (Generation != SearchEntriesGeneration)
 	{
-		FInventorySlot* InventorySlot = GetSlotData(SlotIndex);
-		if (InventorySlot && !InventorySlot->IsEmpty())
-		{
-			SlotsToSort.Add(SlotIndex);
-		}
+		SearchEntries.Reset();
+		SearchEntriesGeneration = Generation;
+		bHasLastSearch = false;
 	}
+}
 
-	SlotsToSort.Sort([this, bAscending](int32 A, int32 B)
-	{
-		FInventorySlot* SlotA = GetSlotData(A);
-		FInventorySlot* SlotB = GetSlotData(B);
-		
-		if (!SlotA || !SlotB) return false;
-
-		FItemData* DataA = GetItemData(SlotA->ItemID);
-		FItemData* DataB = GetItemData(SlotB->ItemID);
-		
-		if (!DataA || !DataB) return false;
-
-		return bAscending ? (DataA->Weight < DataB->Weight) : (DataA->Weight > DataB->Weight);
-	});
+void UInventorySearchSortWidget::PrepareSearchQuery(const FString& SearchTerm)
+{
+	// Reset + Append keeps the buffer's capacity across keystrokes
+	SearchQueryScratch.Reset();
+	SearchQueryScratch.Append(SearchTerm);
+	SearchQueryScratch.ToLowerInline();
 
-	FilteredSlotIndices = SlotsToSort;
+	SearchTrigramScratch.Reset();
+	AppendTrigrams(SearchQueryScratch, SearchTrigramScratch);
 }
 
-void UInventorySearchSortWidget::SortByValue(bool bAscending)
+bool UInventorySearchSortWidget::DoesSlotMatchPreparedQuery(const FInventorySlot& InventorySlot)
 {
-	if (!OwnerInventoryComp)
+	if (InventorySlot.IsEmpty())
 	{
-		return;
+		return false;
 	}
 
-	TArray<int32> SlotsToSort;
-	for (int32 SlotIndex : OriginalSlotOrder)
+	const FInventorySearchEntry* Entry = GetSearchEntry(InventorySlot.ItemID);
+	if (!Entry)
 	{
-		FInventorySlot* InventorySlot = GetSlotData(SlotIndex);
-		if (InventorySlot && !InventorySlot->IsEmpty())
-		{
-			SlotsToSort.Add(SlotIndex);
-		}
+		return false;
 	}
 
-	SlotsToSort.Sort([this, bAscending](int32 A, int32 B)
+	// Every query trigram must appear somewhere in the item's text
+	for (const uint32 Trigram : SearchTrigramScratch)
 	{
-		FInventorySlot* SlotA = GetSlotData(A);
-		FInventorySlot* SlotB = GetSlotData(B);
-		
-		if (!SlotA || !SlotB) return false;
-
-		FItemData* DataA = GetItemData(SlotA->ItemID);
-		FItemData* DataB = GetItemData(SlotB->ItemID);
-		
-		if (!DataA || !DataB) return false;
-
-		return bAscending ? (DataA->BaseValue < DataB->BaseValue) : (DataA->BaseValue > DataB->BaseValue);
-	});
+		if (Algo::BinarySearch(Entry->Trigrams, Trigram) == INDEX_NONE)
+		{
+			return false;
+		}
+	}
 
-	FilteredSlotIndices = SlotsToSort;
+	// Trigrams can't see order or field boundaries - confirm with a real substring test
+	return FCString::Strstr(*Entry->Haystack, *SearchQueryScratch) != nullptr;
 }
 
-void UInventorySearchSortWidget::SortByQuantity(bool bAscending)
+const FInventorySearchEntry* UInventorySearchSortWidget::GetSearchEntry(FName ItemID)
 {
-	if (!OwnerInventoryComp)
+	if (const FInventorySearchEntry* Existing = SearchEntries.Find(ItemID))
 	{
-		return;
+		return Existing;
 	}
 
-	TArray<int32> SlotsToSort;
-	for (int32 SlotIndex : OriginalSlotOrder)
+	const FItemData* ItemData = GetItemData(ItemID);
+	if (!ItemData)
 	{
-		FInventorySlot* InventorySlot = GetSlotData(SlotIndex);
-		if (InventorySlot && !InventorySlot->IsEmpty())
-		{
-			SlotsToSort.Add(SlotIndex);
-		}
+		return nullptr;
 	}
 
-	SlotsToSort.Sort([this, bAscending](int32 A, int32 B)
-	{
-		FInventorySlot* SlotA = GetSlotData(A);
-		FInventorySlot* SlotB = GetSlotData(B);
-		
-		if (!SlotA || !SlotB) return false;
-
-		return bAscending ? (SlotA->Quantity < SlotB->Quantity) : (SlotA->Quantity > SlotB->Quantity);
-	});
+	FInventorySearchEntry& Entry = SearchEntries.Add(ItemID);
+	Entry.Haystack = ItemData->DisplayName.ToString();
+	Entry.Haystack += TEXT("\n");
+	Entry.Haystack += ItemData->Description.ToString();
 
-	FilteredSlotIndices = SlotsToSort;
-}
+	const FGameplayTag TypeTag = GetTypeTag(ItemData);
+	if (TypeTag.IsValid())
+	{
+		Entry.Haystack += TEXT("\n");
+		Entry.Haystack += TypeTag.ToString();
+	}
 
-void UInventorySearchSortWidget::SortBySearch()
-{
-	if (!EditableText_SearchBar)
+	const FGameplayTag RarityTag = GetRarityTag(ItemData);
+	if (RarityTag.IsValid())
 	{
-		return;
+		Entry.Haystack += TEXT("\n");
+		Entry.Haystack += RarityTag.ToString();
 	}
 
-	const FString SearchText = EditableText_SearchBar->GetText().ToString();
-	FilteredSlotIndices = FilterSlotsBySearch(SearchText);
-}
+	Entry.Haystack.ToLowerInline();
 
-void UInventorySearchSortWidget::RestoreOriginalOrder()
-{
-	FilteredSlotIndices = OriginalSlotOrder;
-}
+	AppendTrigrams(Entry.Haystack, Entry.Trigrams);
+	Entry.Trigrams.Sort();
+	Entry.Trigrams.SetNum(Algo::Unique(Entry.Trigrams));
 
-void UInventorySearchSortWidget::ReorderGridVisually()
-{
-	// Destiny 2-style: Keep slots in place, just dim non-matches
-	// Actual reordering would require recreating grid slots
+	return &Entry;
 }
 
-TArray<int32> UInventorySearchSortWidget::FilterSlotsBySearch(const FString& SearchTerm)
+void UInventorySearchSortWidget::AppendTrigrams(const FString& LowerText, TArray<uint32>& OutTrigrams)
 {
-	TArray<int32> MatchingSlots;
-
-	for (int32 i = 0; i < AllSlotWidgets.Num(); ++i)
+	// 10 bits per character; non-ASCII collisions only cost an extra substring test, never a miss
+	const int32 Len = LowerText.Len();
+	for (int32 i = 0; i + 2 < Len; ++i)
 	{
-		if (DoesSlotMatchSearch(i, SearchTerm))
-		{
-			MatchingSlots.Add(i);
-		}
+		const uint32 Trigram =
+			((static_cast<uint32>(LowerText[i]) & 0x3FF) << 20) |
+			((static_cast<uint32>(LowerText[i + 1]) & 0x3FF) << 10) |
+			(static_cast<uint32>(LowerText[i + 2]) & 0x3FF);
+		OutTrigrams.Add(Trigram);
 	}
-
-	return MatchingSlots;
 }
 
 void UInventorySearchSortWidget::HighlightSlotInGrid(int32 SlotIndex)
@@ -626,60 +610,17 @@ void UInventorySearchSortWidget::HighlightSlotInGrid(int32 SlotIndex)
 
 int32 UInventorySearchSortWidget::GetRaritySortValue(const FGameplayTag& RarityTag) const
 {
-	if (RarityTag == FWWTagLibrary::Inventory_Item_Rarity_Common()) return 0;
-	if (RarityTag == FWWTagLibrary::Inventory_Item_Rarity_Uncommon()) return 1;
-	if (RarityTag == FWWTagLibrary::Inventory_Item_Rarity_Rare()) return 2;
-	if (RarityTag == FWWTagLibrary::Inventory_Item_Rarity_Epic()) return 3;
-	if (RarityTag == FWWTagLibrary::Inventory_Item_Rarity_Legendary()) return 4;
-	return 0;
+	return InventorySortKeys::GetRaritySortValue(RarityTag);
 }
 
 FGameplayTag UInventorySearchSortWidget::GetRarityTag(const FItemData* ItemData) const
 {
-	if (!ItemData)
-	{
-		return FGameplayTag();
-	}
-
-	FGameplayTagContainer Tags = ItemData->GameplayTags;
-	
-	if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Rarity_Legendary()))
-		return FWWTagLibrary::Inventory_Item_Rarity_Legendary();
-	if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Rarity_Epic()))
-		return FWWTagLibrary::Inventory_Item_Rarity_Epic();
-	if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Rarity_Rare()))
-		return FWWTagLibrary::Inventory_Item_Rarity_Rare();
-	if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Rarity_Uncommon()))
-		return FWWTagLibrary::Inventory_Item_Rarity_Uncommon();
-	if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Rarity_Common()))
-		return FWWTagLibrary::Inventory_Item_Rarity_Common();
-	
-	return FGameplayTag();
+	return InventorySortKeys::GetRarityTag(ItemData);
 }
 
 FGameplayTag UInventorySearchSortWidget::GetTypeTag(const FItemData* ItemData) const
 {
-	if (!ItemData)
-	{
-		return FGameplayTag();
-	}
-
-	FGameplayTagContainer Tags = ItemData->GameplayTags;
-	
-	if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Type_Weapon()))
-		return FWWTagLibrary::Inventory_Item_Type_Weapon();
-	if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Type_Armor()))
-		return FWWTagLibrary::Inventory_Item_Type_Armor();
-	if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Type_Consumable()))
-		return FWWTagLibrary::Inventory_Item_Type_Consumable();
-	if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Type_KeyItem()))
-		return FWWTagLibrary::Inventory_Item_Type_KeyItem();
-	if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Type_Crafting()))
-		return FWWTagLibrary::Inventory_Item_Type_Crafting();
-	if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Type_Quest()))
-		return FWWTagLibrary::Inventory_Item_Type_Quest();
-	
-	return FGameplayTag();
+	return InventorySortKeys::GetTypeTag(ItemData);
 }
 
 FReply UInventorySearchSortWidget::NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent)
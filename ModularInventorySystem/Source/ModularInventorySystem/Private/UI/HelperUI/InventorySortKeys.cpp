@@ -0,0 +1,365 @@
+// InventorySortKeys.cpp
+// Precomputed sort keys for the inventory search/sort widget + sort benchmark
+
+#include "UI/HelperUI/InventorySortKeys.h"
+#include "Lib/Data/ModularInventorySystem/InventoryData.h"
+#include "Utilities/Helpers/Item/ItemDefinitionCache.h"
+#include "WW_TagLibrary.h"
+#include "Engine/DataTable.h"
+#include "HAL/IConsoleManager.h"
+#include "Logging/InteractableInventoryLogging.h"
+#include "Utilities/JsonReader/ItemJsonReader.h"
+
+namespace InventorySortKeys
+{
+	/** Rank strings (FString::operator< order, equal strings share a rank) */
+	static void RankStrings(const TArray<FString>& Strings, TArray<int32>& OutRanks)
+	{
+		TArray<int32> Order;
+		Order.SetNumUninitialized(Strings.Num());
+		for (int32 i = 0; i < Order.Num(); ++i)
+		{
+			Order[i] = i;
+		}
+
+		Order.Sort([&Strings](int32 A, int32 B)
+		{
+			return Strings[A] < Strings[B];
+		});
+
+		OutRanks.SetNumUninitialized(Strings.Num());
+		int32 Rank = 0;
+		for (int32 i = 0; i < Order.Num(); ++i)
+		{
+			if (i > 0 && Strings[Order[i - 1]] < Strings[Order[i]])
+			{
+				Rank++;
+			}
+			OutRanks[Order[i]] = Rank;
+		}
+	}
+
+	void BuildKeys(const TArray<FInventorySlot>& Slots, TConstArrayView<int32> SlotOrder,
+		const UDataTable* ItemTable, TArray<FInventorySortKey>& OutKeys)
+	{
+		OutKeys.Reset();
+		OutKeys.Reserve(SlotOrder.Num());
+
+		FItemDefinitionCache* Definitions = ItemTable ? &FItemDefinitionCache::Get(ItemTable) : nullptr;
+
+		// Distinct items present - strings and tags are resolved per item, not per slot
+		TArray<const FItemData*> DistinctItems;
+		TMap<FName, int32> DistinctIndexByItemID;
+		TArray<int32> KeyDistinctIndex;
+		KeyDistinctIndex.Reserve(SlotOrder.Num());
+
+		for (const int32 SlotIndex : SlotOrder)
+		{
+			if (!Slots.IsValidIndex(SlotIndex) || Slots[SlotIndex].IsEmpty())
+			{
+				continue;
+			}
+
+			const FInventorySlot& Slot = Slots[SlotIndex];
+
+			int32 DistinctIndex;
+			if (const int32* Existing = DistinctIndexByItemID.Find(Slot.ItemID))
+			{
+				DistinctIndex = *Existing;
+			}
+			else
+			{
+				DistinctIndex = DistinctItems.Add(Definitions ? Definitions->Find(Slot.ItemID) : nullptr);
+				DistinctIndexByItemID.Add(Slot.ItemID, DistinctIndex);
+			}
+
+			FInventorySortKey& Key = OutKeys.AddDefaulted_GetRef();
+			Key.SlotIndex = SlotIndex;
+			Key.Quantity = Slot.Quantity;
+			KeyDistinctIndex.Add(DistinctIndex);
+		}
+
+		TArray<FString> Names;
+		TArray<FString> Types;
+		Names.SetNum(DistinctItems.Num());
+		Types.SetNum(DistinctItems.Num());
+
+		for (int32 i = 0; i < DistinctItems.Num(); ++i)
+		{
+			if (const FItemData* ItemData = DistinctItems[i])
+			{
+				Names[i] = ItemData->DisplayName.ToString();
+				Types[i] = GetTypeTag(ItemData).ToString();
+			}
+		}
+
+		TArray<int32> NameRanks;
+		TArray<int32> TypeRanks;
+		RankStrings(Names, NameRanks);
+		RankStrings(Types, TypeRanks);
+
+		for (int32 i = 0; i < OutKeys.Num(); ++i)
+		{
+			FInventorySortKey& Key = OutKeys[i];
+			const int32 DistinctIndex = KeyDistinctIndex[i];
+
+			Key.NameRank = NameRanks[DistinctIndex];
+			Key.TypeRank = TypeRanks[DistinctIndex];
+
+			if (const FItemData* ItemData = DistinctItems[DistinctIndex])
+			{
+				Key.Rarity = static_cast<uint8>(GetRaritySortValue(GetRarityTag(ItemData)));
+				Key.Weight = ItemData->Weight;
+				Key.Value = ItemData->BaseValue;
+			}
+		}
+	}
+
+	template<typename ProjectionType>
+	static void SortOrderBy(TArray<int32>& Order, TConstArrayView<FInventorySortKey> Keys, bool bAscending, ProjectionType Projection)
+	{
+		Order.Sort([&Keys, bAscending, &Projection](int32 A, int32 B)
+		{
+			const auto KeyA = Projection(Keys[A]);
+			const auto KeyB = Projection(Keys[B]);
+			if (KeyA != KeyB)
+			{
+				return bAscending ? (KeyA < KeyB) : (KeyB < KeyA);
+			}
+			return A < B;
+		});
+	}
+
+	void SortSlots(TConstArrayView<FInventorySortKey> Keys, EInventorySortMode Mode, bool bAscending, TArray<int32>& OutSlotOrder)
+	{
+		TArray<int32> Order;
+		Order.SetNumUninitialized(Keys.Num());
+		for (int32 i = 0; i < Order.Num(); ++i)
+		{
+			Order[i] = i;
+		}
+
+		switch (Mode)
+		{
+		case EInventorySortMode::Name:     SortOrderBy(Order, Keys, bAscending, [](const FInventorySortKey& Key) { return Key.NameRank; }); break;
+		case EInventorySortMode::Rarity:   SortOrderBy(Order, Keys, bAscending, [](const FInventorySortKey& Key) { return Key.Rarity; }); break;
+		case EInventorySortMode::Type:     SortOrderBy(Order, Keys, bAscending, [](const FInventorySortKey& Key) { return Key.TypeRank; }); break;
+		case EInventorySortMode::Weight:   SortOrderBy(Order, Keys, bAscending, [](const FInventorySortKey& Key) { return Key.Weight; }); break;
+		case EInventorySortMode::Value:    SortOrderBy(Order, Keys, bAscending, [](const FInventorySortKey& Key) { return Key.Value; }); break;
+		case EInventorySortMode::Quantity: SortOrderBy(Order, Keys, bAscending, [](const FInventorySortKey& Key) { return Key.Quantity; }); break;
+		}
+
+		OutSlotOrder.Reset(Order.Num());
+		for (const int32 KeyIndex : Order)
+		{
+			OutSlotOrder.Add(Keys[KeyIndex].SlotIndex);
+		}
+	}
+
+	FGameplayTag GetRarityTag(const FItemData* ItemData)
+	{
+		if (!ItemData)
+		{
+			return FGameplayTag();
+		}
+
+		const FGameplayTagContainer& Tags = ItemData->GameplayTags;
+
+		if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Rarity_Legendary()))
+			return FWWTagLibrary::Inventory_Item_Rarity_Legendary();
+		if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Rarity_Epic()))
+			return FWWTagLibrary::Inventory_Item_Rarity_Epic();
+		if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Rarity_Rare()))
+			return FWWTagLibrary::Inventory_Item_Rarity_Rare();
+		if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Rarity_Uncommon()))
+			return FWWTagLibrary::Inventory_Item_Rarity_Uncommon();
+		if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Rarity_Common()))
+			return FWWTagLibrary::Inventory_Item_Rarity_Common();
+
+		return FGameplayTag();
+	}
+
+	FGameplayTag GetTypeTag(const FItemData* ItemData)
+	{
+		if (!ItemData)
+		{
+			return FGameplayTag();
+		}
+
+		const FGameplayTagContainer& Tags = ItemData->GameplayTags;
+
+		if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Type_Weapon()))
+			return FWWTagLibrary::Inventory_Item_Type_Weapon();
+		if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Type_Armor()))
+			return FWWTagLibrary::Inventory_Item_Type_Armor();
+		if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Type_Consumable()))
+			return FWWTagLibrary::Inventory_Item_Type_Consumable();
+		if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Type_KeyItem()))
+			return FWWTagLibrary::Inventory_Item_Type_KeyItem();
+		if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Type_Crafting()))
+			return FWWTagLibrary::Inventory_Item_Type_Crafting();
+		if (Tags.HasTag(FWWTagLibrary::Inventory_Item_Type_Quest()))
+			return FWWTagLibrary::Inventory_Item_Type_Quest();
+
+		return FGameplayTag();
+	}
+
+	int32 GetRaritySortValue(const FGameplayTag& RarityTag)
+	{
+		if (RarityTag == FWWTagLibrary::Inventory_Item_Rarity_Common()) return 0;
+		if (RarityTag == FWWTagLibrary::Inventory_Item_Rarity_Uncommon()) return 1;
+		if (RarityTag == FWWTagLibrary::Inventory_Item_Rarity_Rare()) return 2;
+		if (RarityTag == FWWTagLibrary::Inventory_Item_Rarity_Epic()) return 3;
+		if (RarityTag == FWWTagLibrary::Inventory_Item_Rarity_Legendary()) return 4;
+		return 0;
+	}
+}
+
+// ============================================================================
+// SORT BENCHMARK (development builds only)
+// ============================================================================
+
+#if !UE_BUILD_SHIPPING
+
+namespace InventorySortBenchmark
+{
+	static const TCHAR* GetModeName(EInventorySortMode Mode)
+	{
+		switch (Mode)
+		{
+		case EInventorySortMode::Name:     return TEXT("Name");
+		case EInventorySortMode::Rarity:   return TEXT("Rarity");
+		case EInventorySortMode::Type:     return TEXT("Type");
+		case EInventorySortMode::Weight:   return TEXT("Weight");
+		case EInventorySortMode::Value:    return TEXT("Value");
+		case EInventorySortMode::Quantity: return TEXT("Quantity");
+		default:                           return TEXT("Unknown");
+		}
+	}
+
+	/** The old widget comparators: a row fetch (and for Name/Type a string build) per comparison */
+	static void LegacySort(TArray<int32>& Order, const TArray<FInventorySlot>& Slots, const UDataTable* ItemTable,
+		EInventorySortMode Mode, bool bAscending)
+	{
+		Order.Sort([&Slots, ItemTable, Mode, bAscending](int32 A, int32 B)
+		{
+			const FInventorySlot& SlotA = Slots[A];
+			const FInventorySlot& SlotB = Slots[B];
+
+			if (Mode == EInventorySortMode::Quantity)
+			{
+				return bAscending ? (SlotA.Quantity < SlotB.Quantity) : (SlotA.Quantity > SlotB.Quantity);
+			}
+
+			const FItemData* DataA = ItemTable->FindRow<FItemData>(SlotA.ItemID, TEXT("Benchmark"));
+			const FItemData* DataB = ItemTable->FindRow<FItemData>(SlotB.ItemID, TEXT("Benchmark"));
+			if (!DataA || !DataB) return false;
+
+			switch (Mode)
+			{
+			case EInventorySortMode::Name:
+			{
+				const FString NameA = DataA->DisplayName.ToString();
+				const FString NameB = DataB->DisplayName.ToString();
+				return bAscending ? (NameA < NameB) : (NameA > NameB);
+			}
+			case EInventorySortMode::Rarity:
+			{
+				const int32 RarityA = InventorySortKeys::GetRaritySortValue(InventorySortKeys::GetRarityTag(DataA));
+				const int32 RarityB = InventorySortKeys::GetRaritySortValue(InventorySortKeys::GetRarityTag(DataB));
+				return bAscending ? (RarityA < RarityB) : (RarityA > RarityB);
+			}
+			case EInventorySortMode::Type:
+			{
+				const FString TypeA = InventorySortKeys::GetTypeTag(DataA).ToString();
+				const FString TypeB = InventorySortKeys::GetTypeTag(DataB).ToString();
+				return bAscending ? (TypeA < TypeB) : (TypeA > TypeB);
+			}
+			case EInventorySortMode::Weight:
+				return bAscending ? (DataA->Weight < DataB->Weight) : (DataA->Weight > DataB->Weight);
+			case EInventorySortMode::Value:
+				return bAscending ? (DataA->BaseValue < DataB->BaseValue) : (DataA->BaseValue > DataB->BaseValue);
+			default:
+				return false;
+			}
+		});
+	}
+
+	static void Run(const TArray<FString>& Args)
+	{
+		const int32 NumSlots = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+		constexpr int32 Iterations = 20;
+
+		UDataTable* ItemTable = UItemJsonReader::GetItemDataTable();
+		const TArray<FName> RowNames = ItemTable ? ItemTable->GetRowNames() : TArray<FName>();
+		if (RowNames.Num() == 0)
+		{
+			UE_LOG(LogInventoryInteractableSystem, Error, TEXT("BenchmarkInventorySort: no item DataTable rows loaded"));
+			return;
+		}
+
+		// Synthetic stash cycling through every item definition
+		FRandomStream Random(1337);
+		TArray<FInventorySlot> Slots;
+		TArray<int32> SlotOrder;
+		Slots.SetNum(NumSlots);
+		SlotOrder.SetNumUninitialized(NumSlots);
+		for (int32 i = 0; i < NumSlots; ++i)
+		{
+			Slots[i].ItemID = RowNames[Random.RandRange(0, RowNames.Num() - 1)];
+			Slots[i].Quantity = Random.RandRange(1, 99);
+			SlotOrder[i] = i;
+		}
+
+		UE_LOG(LogInventoryInteractableSystem, Warning, TEXT("=== Inventory Sort Benchmark (%d slots, %d distinct items, avg of %d runs) ==="),
+			NumSlots, RowNames.Num(), Iterations);
+		UE_LOG(LogInventoryInteractableSystem, Warning, TEXT("%-10s %12s %16s %16s"),
+			TEXT("Mode"), TEXT("Legacy ms"), TEXT("Keys+sort ms"), TEXT("Cached sort ms"));
+
+		TArray<int32> Order;
+		TArray<FInventorySortKey> Keys;
+		TArray<int32> SortedSlots;
+
+		for (uint8 ModeIndex = 0; ModeIndex <= static_cast<uint8>(EInventorySortMode::Quantity); ++ModeIndex)
+		{
+			const EInventorySortMode Mode = static_cast<EInventorySortMode>(ModeIndex);
+
+			double LegacySeconds = 0.0;
+			double KeyedSeconds = 0.0;
+			double CachedSeconds = 0.0;
+
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				Order = SlotOrder;
+				double Start = FPlatformTime::Seconds();
+				LegacySort(Order, Slots, ItemTable, Mode, true);
+				LegacySeconds += FPlatformTime::Seconds() - Start;
+
+				Start = FPlatformTime::Seconds();
+				InventorySortKeys::BuildKeys(Slots, SlotOrder, ItemTable, Keys);
+				InventorySortKeys::SortSlots(Keys, Mode, true, SortedSlots);
+				KeyedSeconds += FPlatformTime::Seconds() - Start;
+
+				Start = FPlatformTime::Seconds();
+				InventorySortKeys::SortSlots(Keys, Mode, true, SortedSlots);
+				CachedSeconds += FPlatformTime::Seconds() - Start;
+			}
+
+			UE_LOG(LogInventoryInteractableSystem, Warning, TEXT("%-10s %12.4f %16.4f %16.4f"),
+				GetModeName(Mode),
+				LegacySeconds * 1000.0 / Iterations,
+				KeyedSeconds * 1000.0 / Iterations,
+				CachedSeconds * 1000.0 / Iterations);
+		}
+
+		UE_LOG(LogInventoryInteractableSystem, Warning, TEXT("=========================="));
+	}
+}
+
+static FAutoConsoleCommand GBenchmarkInventorySortCmd(
+	TEXT("BenchmarkInventorySort"),
+	TEXT("Time every inventory sort mode, legacy comparators vs precomputed keys. Usage: BenchmarkInventorySort [NumSlots=1000]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&InventorySortBenchmark::Run)
+);
+
+#endif // !UE_BUILD_SHIPPING
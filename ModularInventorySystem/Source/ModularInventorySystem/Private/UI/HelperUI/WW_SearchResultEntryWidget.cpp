@@ -41,7 +41,7 @@ void UWW_SearchResultEntryWidget::InitializeEntry(int32 InSlotIndex, UInventoryS
 	}
 
 	// Get item data from DataTable
-	FItemData* ItemData = ParentSearchWidget->GetItemData(SlotData->ItemID);
+	const FItemData* ItemData = ParentSearchWidget->GetItemData(SlotData->ItemID);
 	if (!ItemData)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("UWW_SearchResultEntryWidget::InitializeEntry - Failed to find ItemData for ItemID: %s"), *SlotData->ItemID.ToString());
@@ -12,7 +12,9 @@
 //TODO: engine gets it wrong it should have been ModularInventorySystem instead.
 #include "Windwalker_Productions_SharedDefaults.h"
 #include "ModularInventorySystem/Public/Data/InventoryPrediction.h"
+#include "Data/InventoryReplication.h"
 #include "Interfaces/ModularSaveGameSystem/SaveableInterface.h"
+#include "Utilities/Helpers/Item/ItemDefinitionCache.h"
 
 #include "InventoryComponent.generated.h"
 
@@ -29,6 +31,26 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnItemDropped, FInventorySlot,Dr
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPredictionRejected, int32, PredictionID, FString, Reason);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnItemConsumed, FName, ItemID, int32, Quantity);
 
+/** Per-item aggregate kept in sync with the inventory array */
+struct FInventoryItemSlotIndex
+{
+    int32 TotalCount = 0;
+    
+    /** Slots holding this item (unordered) */
+    TArray<int32, TInlineAllocator<4>> SlotIndices;
+};
+
+/** What a slot contributed to the indexes when it was last indexed, so the next write can subtract it */
+struct FInventoryIndexedSlot
+{
+    FName ItemID;           // NAME_None while the slot is empty
+    int32 Quantity = 0;
+    FGuid InstanceID;
+    
+    /** Definition of ItemID, resolved lazily and re-fetched when the item table's generation moves */
+    mutable FItemDefinitionHandle Definition;
+};
+
 
 /**
  * Inventory Component
@@ -192,6 +214,18 @@ public:
     /** Get item data from data table */
     UFUNCTION(BlueprintPure, Category = "Inventory|Data")
     bool GetItemData(FName ItemID, FItemData& OutItemData) const;
+
+    /** Shared, read-only definition row (no copy). Valid until the item table is reloaded */
+    const FItemData* FindItemDefinition(FName ItemID) const;
+
+    /** Packed hot fields (stack size, weight, value, rarity) for per-frame logic */
+    const FItemDefinitionHotData* FindItemHotData(FName ItemID) const;
+    
+    /** Definition of the item in a slot. Player inventory slots resolve through their cached handle (no ItemID hashing) */
+    const FItemData* FindSlotItemDefinition(FGameplayTag InInventoryTypeTag, int32 SlotIndex) const;
+    
+    /** Hot fields of the item in a player inventory slot, through the slot's cached handle */
+    const FItemDefinitionHotData* FindSlotHotData(int32 SlotIndex) const;
     
     /** Get inventory array by type */
     TArray<FInventorySlot>* GetInventoryArray(FGameplayTag InInventoryTypeTag);
@@ -211,6 +245,9 @@ public:
 
     UFUNCTION(BlueprintPure, Category = "Inventory|Data")
     int32 FindSlotIndexByInstanceID(FGuid InstanceID) const;
+    
+    /** Bumped on every indexed slot write - lets views cache results between changes */
+    uint32 GetSlotRevision() const { return SlotRevision; }
 
     UFUNCTION(BlueprintPure, Category = "Inventory|Preview")
     FItemPreviewData GetItemPreviewData(int32 SlotIndex) const;
@@ -327,15 +364,84 @@ protected:
     
     /** Player inventory slots */
     /** It is determined by the tag this component has*/
-    UPROPERTY(SaveGame, ReplicatedUsing=OnRep_Inventory, BlueprintReadOnly, Category = "Inventory")
+    /** Authoritative storage - replicated per slot through ReplicatedInventory */
+    UPROPERTY(SaveGame, BlueprintReadOnly, Category = "Inventory")
     TArray<FInventorySlot> Inventory;
     
     // ============================================================================
     // REPLICATION
     // ============================================================================
     
+    friend struct FInventorySlotEntry;
+    friend struct FInventorySlotList;
+    
+    /** Item-level delta replication of Inventory (owner only) */
+    UPROPERTY(Replicated)
+    FInventorySlotList ReplicatedInventory;
+    
+    /** Set by per-slot client callbacks, flushed once per received bunch */
+    bool bReplicatedSlotsChanged = false;
+    
+    /** Set when a bunch removed entries - the flush trims the trailing slots they covered */
+    bool bReplicatedSlotsRemoved = false;
+    
+    /** Full inventory refresh notification (save load, bulk changes) */
     UFUNCTION()
     void OnRep_Inventory();
+    
+    /** Server: push one slot to owning client */
+    void MarkSlotDirtyForReplication(int32 SlotIndex);
+    
+    /** Server: push the whole inventory to owning client */
+    void MarkAllSlotsDirtyForReplication();
+    
+    /** Client: apply a replicated slot and notify that slot's widgets */
+    void HandleReplicatedSlotChanged(int32 SlotIndex, const FInventorySlot& Slot);
+    
+    /** Client: slot entry removed (inventory shrank) */
+    void HandleReplicatedSlotRemoved(int32 SlotIndex);
+    
+    /** Client: broadcast OnInventoryChanged once after a replication bunch */
+    void FlushReplicatedSlotChanges();
+    
+    // ============================================================================
+    // SLOT INDEXES
+    // ============================================================================
+    /*
+     * Incremental lookups over Inventory, valid on server and owning client.
+     * Every write to a slot must be followed by NotifySlotWritten (BroadcastSlotChange
+     * already does this) - the index subtracts what the slot held before and adds what it holds now.
+     */
+    
+    /** ItemID -> total quantity + slots holding it */
+    TMap<FName, FInventoryItemSlotIndex> ItemSlotIndex;
+    
+    /** InstanceID -> slot */
+    TMap<FGuid, int32> InstanceSlotIndex;
+    
+    /** Bit per slot, set while the slot is empty */
+    TBitArray<> EmptySlotBits;
+    
+    /** Index-aligned with Inventory */
+    TArray<FInventoryIndexedSlot> IndexedSlots;
+    
+    /** See GetSlotRevision */
+    uint32 SlotRevision = 0;
+    
+    /** Slot was written: update indexes and replicate it */
+    void NotifySlotWritten(int32 SlotIndex);
+    
+    /** Whole array was replaced or resized: rebuild indexes and replicate everything */
+    void NotifyAllSlotsWritten();
+    
+    /** Re-index one slot (O(1) amortised) */
+    void ReindexSlot(int32 SlotIndex);
+    
+    /** Rebuild every index from Inventory */
+    void RebuildSlotIndexes();
+    
+    /** Slot's definition handle, refreshed from ItemID only when unset or stale. Null cache when the slot is empty or there is no item table */
+    FItemDefinitionHandle ResolveSlotDefinition(int32 SlotIndex, FItemDefinitionCache*& OutDefinitions) const;
 
 
     // ============================================================================
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Lib/Data/ModularInventorySystem/InventoryData.h"
+#include "Net/Serialization/FastArraySerializer.h"
+
+#include "InventoryReplication.generated.h"
+
+class UInventoryComponent;
+struct FInventorySlotList;
+
+/**
+ * One replicated inventory slot
+ * Carries its own SlotIndex because fast array order is not guaranteed on the client
+ */
+USTRUCT()
+struct MODULARINVENTORYSYSTEM_API FInventorySlotEntry : public FFastArraySerializerItem
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 SlotIndex = INDEX_NONE;
+
+    UPROPERTY()
+    FInventorySlot Slot;
+
+    // Client-side callbacks (called by the fast array serializer)
+    void PreReplicatedRemove(const FInventorySlotList& InArraySerializer);
+    void PostReplicatedAdd(const FInventorySlotList& InArraySerializer);
+    void PostReplicatedChange(const FInventorySlotList& InArraySerializer);
+};
+
+/**
+ * Item-level delta replication for UInventoryComponent
+ *
+ * The component's Inventory array stays the authoritative, save-game storage.
+ * On the server every touched slot is mirrored into Entries and marked dirty,
+ * so a quantity tick sends one entry instead of the whole container.
+ * On the client each received entry is copied back into Inventory and fires
+ * OnInventorySlotChanged for that slot only; OnInventoryChanged fires once per bunch.
+ */
+USTRUCT()
+struct MODULARINVENTORYSYSTEM_API FInventorySlotList : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    /** Server: Entries[i] mirrors Inventory[i]. Client: arbitrary order, use SlotIndex */
+    UPROPERTY()
+    TArray<FInventorySlotEntry> Entries;
+
+    /** Component that owns this list (not replicated, set in the component constructor) */
+    UPROPERTY(NotReplicated)
+    TObjectPtr<UInventoryComponent> OwnerComponent = nullptr;
+
+    /** Server: copy one slot into its entry and mark only that entry dirty */
+    void SetSlot(int32 SlotIndex, const FInventorySlot& Slot);
+
+    /** Server: mirror the whole inventory (initial fill, save load, resize) */
+    void Rebuild(const TArray<FInventorySlot>& Slots);
+
+    // Serializer-level callback - one OnInventoryChanged per received bunch
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FInventorySlotEntry, FInventorySlotList>(Entries, DeltaParms, *this);
+    }
+};
+
+template<>
+struct TStructOpsTypeTraits<FInventorySlotList> : public TStructOpsTypeTraitsBase2<FInventorySlotList>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true,
+    };
+};
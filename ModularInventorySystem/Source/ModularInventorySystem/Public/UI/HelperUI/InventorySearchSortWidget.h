@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "UI/HelperUI/SearchSortWidget_Master.h"
+#include "UI/HelperUI/InventorySortKeys.h"
 #include "Lib/Data/ModularInventorySystem/InvnetoryData.h"
 #include "InventorySearchSortWidget.generated.h"
 
@@ -15,6 +16,15 @@ class UWW_SearchResultEntryWidget;
 class UDataTable;
 struct FItemData;
 
+/** Pre-lowered searchable text for one item definition */
+struct FInventorySearchEntry
+{
+	/** DisplayName, Description, type tag and rarity tag - lower-cased, newline separated */
+	FString Haystack;
+
+	/** Packed trigrams of Haystack (sorted, unique) - rejects most items before the substring test */
+	TArray<uint32> Trigrams;
+};
 
 
 /**
@@ -34,7 +44,7 @@ class MODULARINVENTORYSYSTEM_API UInventorySearchSortWidget : public USearchSort
 public:
 	UInventorySearchSortWidget(const FObjectInitializer& ObjectInitializer);
 	virtual FInventorySlot* GetSlotData(int32 SlotIndex) override;
-	virtual FItemData* GetItemData(FName ItemID) override;
+	virtual const FItemData* GetItemData(FName ItemID) override;
 	virtual void OnSearchResultClicked(int32 SlotIndex) override;
 	/**
  * Set reference to the inventory grid to manipulate
@@ -91,6 +101,38 @@ protected:
 	UPROPERTY()
 	TArray<int32> OriginalSlotOrder;
 
+	// ============================================================================
+	// SEARCH INDEX
+	// ============================================================================
+
+	/** ItemID -> searchable text, built on first sight of an item */
+	TMap<FName, FInventorySearchEntry> SearchEntries;
+
+	/** Item definition generation the entries were built from */
+	uint32 SearchEntriesGeneration = 0;
+
+	/** Previous query (lower-cased) and its matches - reused while the user keeps typing */
+	FString LastSearchQuery;
+	TArray<int32> LastSearchMatches;
+	uint32 LastSearchSlotRevision = 0;
+	bool bHasLastSearch = false;
+
+	/** Per-keystroke scratch, kept to avoid reallocating */
+	FString SearchQueryScratch;
+	TArray<uint32> SearchTrigramScratch;
+
+	// ============================================================================
+	// SORT KEYS
+	// ============================================================================
+
+	/** One key per non-empty slot in OriginalSlotOrder order */
+	TArray<FInventorySortKey> SortKeys;
+
+	/** Inventory state the keys were built from */
+	uint32 SortKeysSlotRevision = 0;
+	uint32 SortKeysGeneration = 0;
+	bool bSortKeysValid = false;
+
 	// ============================================================================
 	// LIFECYCLE
 	// ============================================================================
@@ -174,6 +216,12 @@ protected:
 	 */
 	void SortBySearch();
 
+	/** Order non-empty slots into FilteredSlotIndices using the cached keys */
+	void SortSlotsBy(EInventorySortMode Mode, bool bAscending);
+
+	/** Sort keys for the current inventory, rebuilt only when slots or item definitions changed */
+	const TArray<FInventorySortKey>& GetSortKeys();
+
 	/**
 	 * Restore original slot order (Custom mode)
 	 */
@@ -196,6 +244,21 @@ protected:
 	 */
 	TArray<int32> FilterSlotsBySearch(const FString& SearchTerm);
 
+	/** Drop every cached entry and result if the item table was reloaded */
+	void RefreshSearchIndexIfStale();
+
+	/** Lower-case SearchTerm and its trigrams into the scratch buffers */
+	void PrepareSearchQuery(const FString& SearchTerm);
+
+	/** Slot against the prepared query */
+	bool DoesSlotMatchPreparedQuery(const FInventorySlot& InventorySlot);
+
+	/** Searchable text for an item (built lazily) */
+	const FInventorySearchEntry* GetSearchEntry(FName ItemID);
+
+	/** Append the packed trigrams of an already lower-cased string */
+	static void AppendTrigrams(const FString& LowerText, TArray<uint32>& OutTrigrams);
+
 	/**
 	 * Highlight/select a slot in the grid
 	 * @param SlotIndex - Slot index to highlight
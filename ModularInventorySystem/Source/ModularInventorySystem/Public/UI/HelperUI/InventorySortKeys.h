@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class UDataTable;
+struct FItemData;
+struct FInventorySlot;
+
+/** Sort modes the search/sort widget can order slots by */
+enum class EInventorySortMode : uint8
+{
+	Name,
+	Rarity,
+	Type,
+	Weight,
+	Value,
+	Quantity
+};
+
+/**
+ * Everything a slot is sorted by, resolved once per key build
+ * Names and types are stored as ranks among the distinct values present,
+ * so comparisons never touch a string.
+ */
+struct FInventorySortKey
+{
+	int32 SlotIndex = INDEX_NONE;
+	int32 NameRank = 0;
+	int32 TypeRank = 0;
+	int32 Value = 0;
+	int32 Quantity = 0;
+	float Weight = 0.f;
+	uint8 Rarity = 0;
+};
+
+namespace InventorySortKeys
+{
+	/**
+	 * Build one key per non-empty slot, in SlotOrder order
+	 * One definition lookup per slot; name/type strings are only compared once per distinct item.
+	 */
+	MODULARINVENTORYSYSTEM_API void BuildKeys(const TArray<FInventorySlot>& Slots, TConstArrayView<int32> SlotOrder,
+		const UDataTable* ItemTable, TArray<FInventorySortKey>& OutKeys);
+
+	/** Sort keys by mode and write the resulting slot order (ties keep SlotOrder order) */
+	MODULARINVENTORYSYSTEM_API void SortSlots(TConstArrayView<FInventorySortKey> Keys, EInventorySortMode Mode,
+		bool bAscending, TArray<int32>& OutSlotOrder);
+
+	/** Highest rarity tag in the item's GameplayTags (Legendary first) */
+	MODULARINVENTORYSYSTEM_API FGameplayTag GetRarityTag(const FItemData* ItemData);
+
+	/** First matching type tag in the item's GameplayTags */
+	MODULARINVENTORYSYSTEM_API FGameplayTag GetTypeTag(const FItemData* ItemData);
+
+	/** 0 = Common ... 4 = Legendary */
+	MODULARINVENTORYSYSTEM_API int32 GetRaritySortValue(const FGameplayTag& RarityTag);
+}
@@ -228,7 +228,7 @@ protected:
 	 * @param ItemID - Item ID to look up
 	 * @return Pointer to item data or nullptr
 	 */
-	virtual FItemData* GetItemData(FName ItemID) PURE_VIRTUAL(USearchSortWidgetBase::GetItemData, return nullptr;);
+	virtual const FItemData* GetItemData(FName ItemID) PURE_VIRTUAL(USearchSortWidgetBase::GetItemData, return nullptr;);
 
 public:
 	/**
@@ -5,8 +5,96 @@
 #include "Lib/Data/Tags/WW_TagLibrary.h"
 #include "Net/UnrealNetwork.h"
 
+#if !UE_BUILD_SHIPPING
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#endif
+
 DEFINE_LOG_CATEGORY_STATIC(LogQuestTracker, Log, All);
 
+// ============================================================================
+// QUEST LOG INDEX
+// ============================================================================
+
+void FQuestLogIndex::Add(const FQuestInstance& Instance, int32 LogIndex, const FGameplayTag& QuestType)
+{
+	IndexByID.Add(Instance.QuestID, LogIndex);
+	ByState.FindOrAdd(Instance.StateTag).Add(LogIndex);
+	if (QuestType.IsValid())
+	{
+		ByType.FindOrAdd(QuestType).Add(LogIndex);
+	}
+}
+
+void FQuestLogIndex::UpdateState(int32 LogIndex, const FGameplayTag& OldState, const FGameplayTag& NewState)
+{
+	if (OldState == NewState) return;
+
+	if (TSet<int32>* OldBucket = ByState.Find(OldState))
+	{
+		OldBucket->Remove(LogIndex);
+	}
+	ByState.FindOrAdd(NewState).Add(LogIndex);
+}
+
+void FQuestLogIndex::Rebuild(const TArray<FQuestInstance>& Log, TFunctionRef<FGameplayTag(FName)> GetQuestType)
+{
+	Reset();
+	IndexByID.Reserve(Log.Num());
+	for (int32 i = 0; i < Log.Num(); i++)
+	{
+		Add(Log[i], i, GetQuestType(Log[i].QuestID));
+	}
+}
+
+void FQuestLogIndex::Reset()
+{
+	IndexByID.Reset();
+	ByState.Reset();
+	ByType.Reset();
+}
+
+int32 FQuestLogIndex::Find(FName QuestID) const
+{
+	const int32* LogIndex = IndexByID.Find(QuestID);
+	return LogIndex ? *LogIndex : INDEX_NONE;
+}
+
+int32 FQuestLogIndex::NumInState(const FGameplayTag& State) const
+{
+	const TSet<int32>* Bucket = ByState.Find(State);
+	return Bucket ? Bucket->Num() : 0;
+}
+
+void FQuestLogIndex::GetByState(const TArray<FQuestInstance>& Log, const FGameplayTag& State, TArray<FName>& OutQuestIDs) const
+{
+	GetBucket(Log, ByState.Find(State), OutQuestIDs);
+}
+
+void FQuestLogIndex::GetByType(const TArray<FQuestInstance>& Log, const FGameplayTag& QuestType, TArray<FName>& OutQuestIDs) const
+{
+	GetBucket(Log, ByType.Find(QuestType), OutQuestIDs);
+}
+
+void FQuestLogIndex::GetBucket(const TArray<FQuestInstance>& Log, const TSet<int32>* Bucket, TArray<FName>& OutQuestIDs)
+{
+	if (!Bucket || Bucket->Num() == 0) return;
+
+	TArray<int32, TInlineAllocator<64>> LogIndices;
+	LogIndices.Reserve(Bucket->Num());
+	for (const int32 LogIndex : *Bucket)
+	{
+		LogIndices.Add(LogIndex);
+	}
+	LogIndices.Sort();
+
+	OutQuestIDs.Reserve(OutQuestIDs.Num() + LogIndices.Num());
+	for (const int32 LogIndex : LogIndices)
+	{
+		OutQuestIDs.Add(Log[LogIndex].QuestID);
+	}
+}
+
 UQuestTrackerComponent::UQuestTrackerComponent()
 {
 	SetIsReplicatedByDefault(true);
@@ -21,6 +109,22 @@ void UQuestTrackerComponent::BeginPlay()
 {
 	Super::BeginPlay();
 	CacheSubsystem();
+
+	// Availability is server-owned; clients receive the resulting log through replication
+	AActor* Owner = GetOwner();
+	if (CachedQuestSubsystem && Owner && Owner->HasAuthority())
+	{
+		CachedQuestSubsystem->RegisterTracker(this);
+	}
+}
+
+void UQuestTrackerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (CachedQuestSubsystem)
+	{
+		CachedQuestSubsystem->UnregisterTracker(this);
+	}
+	Super::EndPlay(EndPlayReason);
 }
 
 void UQuestTrackerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -53,45 +157,57 @@ void UQuestTrackerComponent::AddQuestInstance(const FQuestInstance& Instance)
 		}
 	}
 
-	QuestLog.Add(Instance);
+	if (QuestLogIndex.Find(Instance.QuestID) != INDEX_NONE)
+	{
+		UE_LOG(LogQuestTracker, Warning, TEXT("AddQuestInstance: quest '%s' is already in the log"), *Instance.QuestID.ToString());
+		return;
+	}
+
+	const int32 LogIndex = QuestLog.Add(Instance);
+	QuestLogIndex.Add(Instance, LogIndex, LookupQuestType(Instance.QuestID));
 	UE_LOG(LogQuestTracker, Verbose, TEXT("Added quest '%s' to log"), *Instance.QuestID.ToString());
 }
 
 FQuestInstance* UQuestTrackerComponent::FindQuestInstance(FName QuestID)
 {
-	for (FQuestInstance& Instance : QuestLog)
-	{
-		if (Instance.QuestID == QuestID)
-		{
-			return &Instance;
-		}
-	}
-	return nullptr;
+	const int32 LogIndex = QuestLogIndex.Find(QuestID);
+	return LogIndex != INDEX_NONE ? &QuestLog[LogIndex] : nullptr;
 }
 
 const FQuestInstance* UQuestTrackerComponent::FindQuestInstance(FName QuestID) const
 {
-	for (const FQuestInstance& Instance : QuestLog)
-	{
-		if (Instance.QuestID == QuestID)
-		{
-			return &Instance;
-		}
-	}
-	return nullptr;
+	const int32 LogIndex = QuestLogIndex.Find(QuestID);
+	return LogIndex != INDEX_NONE ? &QuestLog[LogIndex] : nullptr;
+}
+
+bool UQuestTrackerComponent::SetQuestState(FName QuestID, const FGameplayTag& NewState)
+{
+	const int32 LogIndex = QuestLogIndex.Find(QuestID);
+	if (LogIndex == INDEX_NONE) return false;
+
+	FQuestInstance& Instance = QuestLog[LogIndex];
+	QuestLogIndex.UpdateState(LogIndex, Instance.StateTag, NewState);
+	Instance.StateTag = NewState;
+	return true;
+}
+
+TArray<FName> UQuestTrackerComponent::GetQuestIDsByState(FGameplayTag State) const
+{
+	TArray<FName> Result;
+	QuestLogIndex.GetByState(QuestLog, State, Result);
+	return Result;
+}
+
+TArray<FName> UQuestTrackerComponent::GetQuestIDsByType(FGameplayTag QuestType) const
+{
+	TArray<FName> Result;
+	QuestLogIndex.GetByType(QuestLog, QuestType, Result);
+	return Result;
 }
 
 int32 UQuestTrackerComponent::GetActiveQuestCount() const
 {
-	int32 Count = 0;
-	for (const FQuestInstance& Instance : QuestLog)
-	{
-		if (Instance.StateTag == FWWTagLibrary::Quest_State_Active())
-		{
-			Count++;
-		}
-	}
-	return Count;
+	return QuestLogIndex.NumInState(FWWTagLibrary::Quest_State_Active());
 }
 
 bool UQuestTrackerComponent::IsAtMaxActiveQuests() const
@@ -106,9 +222,19 @@ bool UQuestTrackerComponent::IsAtMaxActiveQuests() const
 
 void UQuestTrackerComponent::AddPlayerTag(FGameplayTag Tag)
 {
-	if (Tag.IsValid())
+	if (!Tag.IsValid() || PlayerTags.HasTagExact(Tag)) return;
+
+	PlayerTags.AddTag(Tag);
+
+	// Gaining a tag can only unlock quests (removal never revokes availability)
+	AActor* Owner = GetOwner();
+	if (Owner && Owner->HasAuthority())
 	{
-		PlayerTags.AddTag(Tag);
+		CacheSubsystem();
+		if (CachedQuestSubsystem)
+		{
+			CachedQuestSubsystem->NotifyPlayerTagChanged(Owner, Tag);
+		}
 	}
 }
 
@@ -192,6 +318,7 @@ void UQuestTrackerComponent::Server_RequestTurnInQuest_Implementation(FName Ques
 
 void UQuestTrackerComponent::OnRep_QuestLog()
 {
+	QuestLogIndex.Rebuild(QuestLog, [this](FName QuestID) { return LookupQuestType(QuestID); });
 	UE_LOG(LogQuestTracker, Verbose, TEXT("QuestLog replicated (%d entries)"), QuestLog.Num());
 }
 
@@ -207,3 +334,149 @@ void UQuestTrackerComponent::CacheSubsystem()
 		CachedQuestSubsystem = UQuestSubsystem::Get(this);
 	}
 }
+
+FGameplayTag UQuestTrackerComponent::LookupQuestType(FName QuestID)
+{
+	CacheSubsystem();
+	return CachedQuestSubsystem ? CachedQuestSubsystem->GetQuestType(QuestID) : FGameplayTag();
+}
+
+#if !UE_BUILD_SHIPPING
+
+// ============================================================================
+// BENCHMARK
+// ============================================================================
+
+namespace QuestLogBenchmark
+{
+	static void Run(const TArray<FString>& Args)
+	{
+		const int32 NumEntries = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 2000;
+		const int32 NumQueries = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 10000;
+
+		const FGameplayTag Types[] = { FWWTagLibrary::Quest_Type_Main(), FWWTagLibrary::Quest_Type_Side(),
+			FWWTagLibrary::Quest_Type_Daily(), FWWTagLibrary::Quest_Type_Bounty() };
+
+		// Long-running save: ~85% turned in, a few failed/available, ~20 active
+		FRandomStream Random(1234);
+		TArray<FQuestInstance> Log;
+		TMap<FName, FGameplayTag> QuestTypes;
+		Log.Reserve(NumEntries);
+		for (int32 i = 0; i < NumEntries; i++)
+		{
+			FQuestInstance& Instance = Log.AddDefaulted_GetRef();
+			Instance.QuestID = FName(TEXT("BenchQuest"), i + 1);
+
+			const float Roll = Random.FRand();
+			Instance.StateTag = Roll < 0.85f ? FWWTagLibrary::Quest_State_TurnedIn()
+				: Roll < 0.90f ? FWWTagLibrary::Quest_State_Failed()
+				: Roll < 0.99f ? FWWTagLibrary::Quest_State_Available()
+				: FWWTagLibrary::Quest_State_Active();
+			QuestTypes.Add(Instance.QuestID, Types[Random.RandHelper(UE_ARRAY_COUNT(Types))]);
+		}
+
+		TArray<FName> LookupIDs;
+		LookupIDs.Reserve(NumQueries);
+		for (int32 i = 0; i < NumQueries; i++)
+		{
+			LookupIDs.Add(Log[Random.RandHelper(Log.Num())].QuestID);
+		}
+
+		const FGameplayTag ActiveState = FWWTagLibrary::Quest_State_Active();
+		const FGameplayTag QueryType = FWWTagLibrary::Quest_Type_Main();
+		int64 Checksum = 0;
+
+		// Linear scans (previous behaviour)
+		double Start = FPlatformTime::Seconds();
+		for (const FName& QuestID : LookupIDs)
+		{
+			for (const FQuestInstance& Instance : Log)
+			{
+				if (Instance.QuestID == QuestID)
+				{
+					Checksum += Instance.StateTag.IsValid();
+					break;
+				}
+			}
+		}
+		const double ScanFindMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 q = 0; q < NumQueries; q++)
+		{
+			TArray<FName> Result;
+			for (const FQuestInstance& Instance : Log)
+			{
+				if (Instance.StateTag == ActiveState)
+				{
+					Result.Add(Instance.QuestID);
+				}
+			}
+			Checksum += Result.Num();
+		}
+		const double ScanActiveMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 q = 0; q < NumQueries; q++)
+		{
+			TArray<FName> Result;
+			for (const FQuestInstance& Instance : Log)
+			{
+				if (QuestTypes.FindRef(Instance.QuestID) == QueryType)
+				{
+					Result.Add(Instance.QuestID);
+				}
+			}
+			Checksum += Result.Num();
+		}
+		const double ScanTypeMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		// Indexed
+		FQuestLogIndex Index;
+		Start = FPlatformTime::Seconds();
+		Index.Rebuild(Log, [&QuestTypes](FName QuestID) { return QuestTypes.FindRef(QuestID); });
+		const double BuildMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (const FName& QuestID : LookupIDs)
+		{
+			const int32 LogIndex = Index.Find(QuestID);
+			Checksum += LogIndex != INDEX_NONE && Log[LogIndex].StateTag.IsValid();
+		}
+		const double IndexFindMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 q = 0; q < NumQueries; q++)
+		{
+			TArray<FName> Result;
+			Index.GetByState(Log, ActiveState, Result);
+			Checksum += Result.Num();
+		}
+		const double IndexActiveMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 q = 0; q < NumQueries; q++)
+		{
+			TArray<FName> Result;
+			Index.GetByType(Log, QueryType, Result);
+			Checksum += Result.Num();
+		}
+		const double IndexTypeMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+		UE_LOG(LogTemp, Warning, TEXT("=== Quest Log Benchmark (%d entries, %d active, %d queries) ==="),
+			NumEntries, Index.NumInState(ActiveState), NumQueries);
+		UE_LOG(LogTemp, Warning, TEXT("%-22s %12s %12s %9s"), TEXT("Query"), TEXT("Scan (ms)"), TEXT("Index (ms)"), TEXT("Speedup"));
+		UE_LOG(LogTemp, Warning, TEXT("%-22s %12.3f %12.3f %8.1fx"), TEXT("FindQuestInstance"), ScanFindMs, IndexFindMs, ScanFindMs / FMath::Max(IndexFindMs, 0.001));
+		UE_LOG(LogTemp, Warning, TEXT("%-22s %12.3f %12.3f %8.1fx"), TEXT("Active quests"), ScanActiveMs, IndexActiveMs, ScanActiveMs / FMath::Max(IndexActiveMs, 0.001));
+		UE_LOG(LogTemp, Warning, TEXT("%-22s %12.3f %12.3f %8.1fx"), TEXT("Quests by type"), ScanTypeMs, IndexTypeMs, ScanTypeMs / FMath::Max(IndexTypeMs, 0.001));
+		UE_LOG(LogTemp, Warning, TEXT("Index build: %.3f ms (checksum %lld)"), BuildMs, Checksum);
+	}
+}
+
+static FAutoConsoleCommand GBenchmarkQuestLogCmd(
+	TEXT("BenchmarkQuestLog"),
+	TEXT("Linear quest log scans vs the ID map and state/type buckets. Usage: BenchmarkQuestLog [NumEntries=2000] [NumQueries=10000]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&QuestLogBenchmark::Run)
+);
+
+#endif // !UE_BUILD_SHIPPING
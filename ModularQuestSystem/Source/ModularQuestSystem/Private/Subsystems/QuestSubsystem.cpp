@@ -4,12 +4,140 @@
 #include "Components/QuestTrackerComponent.h"
 #include "Subsystems/ModularQuestSystem/ObjectiveTrackerSubsystem.h"
 #include "Subsystems/EventBusSubsystem.h"
+#include "Subsystems/SaveSystem/SaveableRegistrySubsystem.h"
 #include "Lib/Data/Tags/WW_TagLibrary.h"
 #include "Lib/Data/ModularQuestSystem/GameplayEventData.h"
 #include "Engine/DataTable.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogQuestSystem, Log, All);
 
+// ============================================================================
+// DEPENDENCY GRAPH
+// ============================================================================
+
+void FQuestDependencyGraph::Rebuild(const TMap<FName, FQuestData>& Quests, const TMap<FName, FQuestChain>& Chains)
+{
+	Reset();
+
+	for (const auto& Pair : Chains)
+	{
+		const TArray<FName>& Sequence = Pair.Value.QuestSequence;
+		for (int32 i = 1; i < Sequence.Num(); i++)
+		{
+			const FName* Existing = ChainPredecessors.Find(Sequence[i]);
+			if (Existing && *Existing != Sequence[i - 1])
+			{
+				UE_LOG(LogQuestSystem, Warning, TEXT("FQuestDependencyGraph::Rebuild - quest '%s' follows '%s' and '%s' in different chains, keeping '%s'"),
+					*Sequence[i].ToString(), **Existing, *Sequence[i - 1].ToString(), **Existing);
+				continue;
+			}
+			ChainPredecessors.Add(Sequence[i], Sequence[i - 1]);
+		}
+	}
+
+	for (const auto& Pair : Quests)
+	{
+		const FQuestData& Quest = Pair.Value;
+		for (const FName& PrereqID : Quest.PrerequisiteQuestIDs)
+		{
+			QuestDependents.FindOrAdd(PrereqID).AddUnique(Pair.Key);
+		}
+
+		if (const FName* Predecessor = ChainPredecessors.Find(Pair.Key))
+		{
+			QuestDependents.FindOrAdd(*Predecessor).AddUnique(Pair.Key);
+		}
+
+		for (const FGameplayTag& Tag : Quest.PrerequisiteTags)
+		{
+			TagDependents.FindOrAdd(Tag).Add(Pair.Key);
+		}
+	}
+
+	// Kahn's algorithm over registered quests - whatever never reaches in-degree 0 is on or behind a cycle
+	TMap<FName, int32> InDegree;
+	InDegree.Reserve(Quests.Num());
+	for (const auto& Pair : Quests)
+	{
+		InDegree.Add(Pair.Key, 0);
+	}
+	for (const auto& Pair : QuestDependents)
+	{
+		if (!Quests.Contains(Pair.Key)) continue;
+		for (const FName& Dependent : Pair.Value)
+		{
+			if (int32* Degree = InDegree.Find(Dependent))
+			{
+				(*Degree)++;
+			}
+		}
+	}
+
+	TArray<FName> Ready;
+	for (const auto& Pair : InDegree)
+	{
+		if (Pair.Value == 0)
+		{
+			Ready.Add(Pair.Key);
+		}
+	}
+
+	while (Ready.Num() > 0)
+	{
+		const FName QuestID = Ready.Pop(EAllowShrinking::No);
+		for (const FName& Dependent : GetQuestDependents(QuestID))
+		{
+			int32* Degree = InDegree.Find(Dependent);
+			if (Degree && --(*Degree) == 0)
+			{
+				Ready.Add(Dependent);
+			}
+		}
+	}
+
+	for (const auto& Pair : InDegree)
+	{
+		if (Pair.Value > 0)
+		{
+			CyclicQuests.Add(Pair.Key);
+		}
+	}
+}
+
+void FQuestDependencyGraph::Reset()
+{
+	QuestDependents.Reset();
+	TagDependents.Reset();
+	ChainPredecessors.Reset();
+	CyclicQuests.Reset();
+}
+
+TConstArrayView<FName> FQuestDependencyGraph::GetQuestDependents(FName QuestID) const
+{
+	const TArray<FName>* Dependents = QuestDependents.Find(QuestID);
+	return Dependents ? TConstArrayView<FName>(*Dependents) : TConstArrayView<FName>();
+}
+
+void FQuestDependencyGraph::GetTagDependents(const FGameplayTag& Tag, TArray<FName>& OutQuests) const
+{
+	if (!Tag.IsValid() || TagDependents.Num() == 0) return;
+
+	// A player tag A.B.C satisfies requirements on A.B.C, A.B and A
+	for (const FGameplayTag& Requirement : Tag.GetGameplayTagParents())
+	{
+		if (const TArray<FName>* Dependents = TagDependents.Find(Requirement))
+		{
+			OutQuests.Append(*Dependents);
+		}
+	}
+}
+
+FName FQuestDependencyGraph::GetChainPredecessor(FName QuestID) const
+{
+	const FName* Predecessor = ChainPredecessors.Find(QuestID);
+	return Predecessor ? *Predecessor : NAME_None;
+}
+
 UQuestSubsystem::UQuestSubsystem()
 {
 }
@@ -21,6 +149,7 @@ UQuestSubsystem::UQuestSubsystem()
 void UQuestSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+	Collection.InitializeDependency<USaveableRegistrySubsystem>();
 	CacheSubsystems();
 
 	if (CachedObjectiveTracker)
@@ -30,6 +159,15 @@ void UQuestSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 		CachedObjectiveTracker->OnObjectiveUpdated.AddDynamic(this, &UQuestSubsystem::HandleObjectiveUpdated);
 	}
 
+	// A restored save can carry tags and finished quests the dependents-only updates never saw
+	if (USaveableRegistrySubsystem* Registry = GetGameInstance()->GetSubsystem<USaveableRegistrySubsystem>())
+	{
+		StateRestoredHandle = Registry->OnStateRestored.AddWeakLambda(this, [this]()
+		{
+			EvaluateAvailabilityForTrackers();
+		});
+	}
+
 	UE_LOG(LogQuestSystem, Log, TEXT("QuestSubsystem initialized"));
 }
 
@@ -42,9 +180,19 @@ void UQuestSubsystem::Deinitialize()
 		CachedObjectiveTracker->OnObjectiveUpdated.RemoveDynamic(this, &UQuestSubsystem::HandleObjectiveUpdated);
 	}
 
+	if (USaveableRegistrySubsystem* Registry = GetGameInstance()->GetSubsystem<USaveableRegistrySubsystem>())
+	{
+		Registry->OnStateRestored.Remove(StateRestoredHandle);
+	}
+	StateRestoredHandle.Reset();
+
 	QuestRegistry.Empty();
+	QuestIDsByType.Empty();
 	ChainRegistry.Empty();
 	SetIDToQuestMap.Empty();
+	RegisteredTrackers.Empty();
+	DependencyGraph.Reset();
+	bDependencyGraphDirty = true;
 
 	UE_LOG(LogQuestSystem, Log, TEXT("QuestSubsystem deinitialized"));
 	Super::Deinitialize();
@@ -83,12 +231,18 @@ void UQuestSubsystem::LoadQuestsFromDataTable(UDataTable* QuestTable)
 	{
 		if (Row && Row->IsValid())
 		{
-			QuestRegistry.Add(Row->QuestID, *Row);
+			AddToRegistry(*Row);
 			LoadedCount++;
 		}
 	}
+	bDependencyGraphDirty |= LoadedCount > 0;
 
 	UE_LOG(LogQuestSystem, Log, TEXT("Loaded %d quests from DataTable '%s'"), LoadedCount, *QuestTable->GetName());
+
+	if (LoadedCount > 0)
+	{
+		EvaluateAvailabilityForTrackers();
+	}
 }
 
 void UQuestSubsystem::LoadChainsFromDataTable(UDataTable* ChainTable)
@@ -111,8 +265,14 @@ void UQuestSubsystem::LoadChainsFromDataTable(UDataTable* ChainTable)
 			LoadedCount++;
 		}
 	}
+	bDependencyGraphDirty |= LoadedCount > 0;
 
 	UE_LOG(LogQuestSystem, Log, TEXT("Loaded %d chains from DataTable '%s'"), LoadedCount, *ChainTable->GetName());
+
+	if (LoadedCount > 0)
+	{
+		EvaluateAvailabilityForTrackers();
+	}
 }
 
 bool UQuestSubsystem::RegisterQuest(const FQuestData& QuestDef)
@@ -129,8 +289,13 @@ bool UQuestSubsystem::RegisterQuest(const FQuestData& QuestDef)
 		return false;
 	}
 
-	QuestRegistry.Add(QuestDef.QuestID, QuestDef);
+	AddToRegistry(QuestDef);
+	bDependencyGraphDirty = true;
 	UE_LOG(LogQuestSystem, Verbose, TEXT("Registered quest: %s"), *QuestDef.QuestID.ToString());
+
+	// Only the new quest can change availability - its prerequisites may already be met
+	const FName QuestID = QuestDef.QuestID;
+	EvaluateAvailabilityForTrackers(MakeArrayView(&QuestID, 1));
 	return true;
 }
 
@@ -165,15 +330,14 @@ TArray<FName> UQuestSubsystem::GetAllQuestIDs() const
 
 TArray<FName> UQuestSubsystem::GetQuestsByType(FGameplayTag QuestType) const
 {
-	TArray<FName> Result;
-	for (const auto& Pair : QuestRegistry)
-	{
-		if (Pair.Value.QuestType == QuestType)
-		{
-			Result.Add(Pair.Key);
-		}
-	}
-	return Result;
+	const TArray<FName>* QuestIDs = QuestIDsByType.Find(QuestType);
+	return QuestIDs ? *QuestIDs : TArray<FName>();
+}
+
+FGameplayTag UQuestSubsystem::GetQuestType(FName QuestID) const
+{
+	const FQuestData* Found = QuestRegistry.Find(QuestID);
+	return Found ? Found->QuestType : FGameplayTag();
 }
 
 // ============================================================================
@@ -235,7 +399,7 @@ bool UQuestSubsystem::AcceptQuest(FName QuestID, AActor* Player)
 	FGuid SetID;
 	if (CachedObjectiveTracker && QuestDef->Objectives.IsValid())
 	{
-		SetID = CachedObjectiveTracker->RegisterObjectiveSet(QuestDef->Objectives);
+		SetID = CachedObjectiveTracker->RegisterObjectiveSet(QuestDef->Objectives, Player);
 		RegisterSetIDMapping(SetID, QuestID, Player);
 	}
 
@@ -246,7 +410,7 @@ bool UQuestSubsystem::AcceptQuest(FName QuestID, AActor* Player)
 	if (ExistingInstance)
 	{
 		FGameplayTag OldState = ExistingInstance->StateTag;
-		ExistingInstance->StateTag = FWWTagLibrary::Quest_State_Active();
+		Tracker->SetQuestState(QuestID, FWWTagLibrary::Quest_State_Active());
 		ExistingInstance->ObjectiveSetID = SetID;
 		ExistingInstance->AcceptedTimestamp = WorldTime;
 		ExistingInstance->CompletedTimestamp = 0.0f;
@@ -416,7 +580,7 @@ bool UQuestSubsystem::TurnInQuest(FName QuestID, AActor* Player)
 	{
 		OnQuestTurnedIn.Broadcast(QuestID, Player);
 		BroadcastQuestEvent(FWWTagLibrary::Quest_Event_TurnedIn(), QuestID, Player);
-		RefreshQuestAvailability(Player);
+		EvaluateAvailability(Player, GetDependencyGraph().GetQuestDependents(QuestID));
 		return true;
 	}
 	return false;
@@ -485,6 +649,17 @@ bool UQuestSubsystem::MeetsPrerequisites(FName QuestID, AActor* Player) const
 		}
 	}
 
+	// Chain order: the previous quest in the chain must be TurnedIn too
+	const FName ChainPredecessor = GetDependencyGraph().GetChainPredecessor(QuestID);
+	if (!ChainPredecessor.IsNone())
+	{
+		const FQuestInstance* PredecessorInstance = Tracker->FindQuestInstance(ChainPredecessor);
+		if (!PredecessorInstance || PredecessorInstance->StateTag != FWWTagLibrary::Quest_State_TurnedIn())
+		{
+			return false;
+		}
+	}
+
 	// Check prerequisite tags (player must have all)
 	if (QuestDef->PrerequisiteTags.Num() > 0)
 	{
@@ -499,18 +674,10 @@ bool UQuestSubsystem::MeetsPrerequisites(FName QuestID, AActor* Player) const
 
 TArray<FName> UQuestSubsystem::GetActiveQuests(AActor* Player) const
 {
-	TArray<FName> Result;
 	const UQuestTrackerComponent* Tracker = GetTrackerComponent(Player);
-	if (!Tracker) return Result;
+	if (!Tracker) return TArray<FName>();
 
-	for (const FQuestInstance& Instance : Tracker->GetQuestLog())
-	{
-		if (Instance.StateTag == FWWTagLibrary::Quest_State_Active())
-		{
-			Result.Add(Instance.QuestID);
-		}
-	}
-	return Result;
+	return Tracker->GetQuestIDsByState(FWWTagLibrary::Quest_State_Active());
 }
 
 FName UQuestSubsystem::GetNextChainQuest(FName ChainID, AActor* Player) const
@@ -552,6 +719,20 @@ float UQuestSubsystem::GetQuestProgress(FName QuestID, AActor* Player) const
 // INTERNAL HELPERS
 // ============================================================================
 
+void UQuestSubsystem::AddToRegistry(const FQuestData& QuestDef)
+{
+	if (const FQuestData* Existing = QuestRegistry.Find(QuestDef.QuestID))
+	{
+		if (TArray<FName>* OldBucket = QuestIDsByType.Find(Existing->QuestType))
+		{
+			OldBucket->Remove(QuestDef.QuestID);
+		}
+	}
+
+	QuestRegistry.Add(QuestDef.QuestID, QuestDef);
+	QuestIDsByType.FindOrAdd(QuestDef.QuestType).Add(QuestDef.QuestID);
+}
+
 void UQuestSubsystem::CacheSubsystems()
 {
 	UGameInstance* GI = GetGameInstance();
@@ -589,7 +770,7 @@ bool UQuestSubsystem::TransitionQuestState(FName QuestID, AActor* Player, const
 	const FGameplayTag OldState = Instance->StateTag;
 	if (OldState == NewState) return false;
 
-	Instance->StateTag = NewState;
+	Tracker->SetQuestState(QuestID, NewState);
 
 	// Set completion timestamp for terminal states
 	if (NewState == FWWTagLibrary::Quest_State_Completed() || NewState == FWWTagLibrary::Quest_State_Failed())
@@ -684,30 +865,108 @@ void UQuestSubsystem::UnregisterSetIDMapping(const FGuid& SetID)
 	SetIDToQuestMap.Remove(SetID);
 }
 
-void UQuestSubsystem::RefreshQuestAvailability(AActor* Player)
+const FQuestDependencyGraph& UQuestSubsystem::GetDependencyGraph() const
 {
-	if (!Player) return;
+	if (bDependencyGraphDirty)
+	{
+		DependencyGraph.Rebuild(QuestRegistry, ChainRegistry);
+		bDependencyGraphDirty = false;
+
+		const TArray<FName>& Cyclic = DependencyGraph.GetCyclicQuests();
+		if (Cyclic.Num() > 0)
+		{
+			FString Names;
+			for (const FName& QuestID : Cyclic)
+			{
+				Names += (Names.IsEmpty() ? TEXT("") : TEXT(", ")) + QuestID.ToString();
+			}
+			UE_LOG(LogQuestSystem, Warning, TEXT("%d quests are on or behind a prerequisite cycle and can never become available: %s"), Cyclic.Num(), *Names);
+		}
+	}
+	return DependencyGraph;
+}
+
+void UQuestSubsystem::EvaluateAvailability(AActor* Player, TConstArrayView<FName> Candidates)
+{
+	if (!Player || Candidates.Num() == 0) return;
 
 	UQuestTrackerComponent* Tracker = GetTrackerComponent(Player);
 	if (!Tracker) return;
 
-	for (const auto& Pair : QuestRegistry)
-	{
-		const FGameplayTag CurrentState = GetQuestState(Pair.Key, Player);
+	// Copy - OnQuestAvailable handlers may register quests, which rebuilds the graph the view points into
+	const TArray<FName> QuestIDs(Candidates);
+	TArray<FName> NewlyAvailable;
 
-		// Only check quests that are currently Unavailable (no instance yet)
-		if (CurrentState == FWWTagLibrary::Quest_State_Unavailable())
+	for (const FName& QuestID : QuestIDs)
+	{
+		// Quests already in the log (available, active, abandoned, finished) are owned by the lifecycle functions
+		if (Tracker->FindQuestInstance(QuestID) || !MeetsPrerequisites(QuestID, Player))
 		{
-			if (MeetsPrerequisites(Pair.Key, Player))
-			{
-				FQuestInstance Instance;
-				Instance.QuestID = Pair.Key;
-				Instance.StateTag = FWWTagLibrary::Quest_State_Available();
-				Tracker->AddQuestInstance(Instance);
+			continue;
+		}
 
-				OnQuestAvailable.Broadcast(Pair.Key, Player);
-				UE_LOG(LogQuestSystem, Log, TEXT("Quest '%s' now available for %s"), *Pair.Key.ToString(), *Player->GetName());
-			}
+		FQuestInstance Instance;
+		Instance.QuestID = QuestID;
+		Instance.StateTag = FWWTagLibrary::Quest_State_Available();
+		Tracker->AddQuestInstance(Instance);
+		NewlyAvailable.Add(QuestID);
+
+		OnQuestAvailable.Broadcast(QuestID, Player);
+		UE_LOG(LogQuestSystem, Log, TEXT("Quest '%s' now available for %s"), *QuestID.ToString(), *Player->GetName());
+	}
+
+	if (NewlyAvailable.Num() > 0)
+	{
+		OnQuestAvailabilityChanged.Broadcast(Player, NewlyAvailable);
+	}
+}
+
+void UQuestSubsystem::RefreshQuestAvailability(AActor* Player)
+{
+	TArray<FName> QuestIDs;
+	QuestRegistry.GetKeys(QuestIDs);
+	EvaluateAvailability(Player, QuestIDs);
+}
+
+void UQuestSubsystem::EvaluateAvailabilityForTrackers(TConstArrayView<FName> Candidates)
+{
+	// Copy - OnQuestAvailable handlers may spawn or destroy players
+	const TArray<TWeakObjectPtr<UQuestTrackerComponent>> Trackers = RegisteredTrackers;
+	for (const TWeakObjectPtr<UQuestTrackerComponent>& Tracker : Trackers)
+	{
+		if (!Tracker.IsValid()) continue;
+
+		if (Candidates.Num() == 0)
+		{
+			RefreshQuestAvailability(Tracker->GetOwner());
+		}
+		else
+		{
+			EvaluateAvailability(Tracker->GetOwner(), Candidates);
 		}
 	}
+
+	RegisteredTrackers.RemoveAllSwap([](const TWeakObjectPtr<UQuestTrackerComponent>& Tracker) { return !Tracker.IsValid(); });
+}
+
+void UQuestSubsystem::RegisterTracker(UQuestTrackerComponent* Tracker)
+{
+	if (!Tracker || !Tracker->GetOwner()) return;
+
+	RegisteredTrackers.AddUnique(Tracker);
+
+	// Quests with no prerequisites, or ones met before this player existed, unlock here
+	RefreshQuestAvailability(Tracker->GetOwner());
+}
+
+void UQuestSubsystem::UnregisterTracker(UQuestTrackerComponent* Tracker)
+{
+	RegisteredTrackers.RemoveSwap(Tracker);
+}
+
+void UQuestSubsystem::NotifyPlayerTagChanged(AActor* Player, const FGameplayTag& Tag)
+{
+	TArray<FName> Dependents;
+	GetDependencyGraph().GetTagDependents(Tag, Dependents);
+	EvaluateAvailability(Player, Dependents);
 }
@@ -6,10 +6,38 @@
 #include "Components/ActorComponent.h"
 #include "Lib/Data/ModularQuestSystem/QuestData.h"
 #include "GameplayTagContainer.h"
+#include "Templates/Function.h"
 #include "QuestTrackerComponent.generated.h"
 
 class UQuestSubsystem;
 
+/**
+ * Lookup tables over a quest log: QuestID -> log index, plus state and type buckets of log indices.
+ * Entries are never removed from the log, so indices stay valid. Bucket queries return IDs in log order.
+ */
+class MODULARQUESTSYSTEM_API FQuestLogIndex
+{
+public:
+	void Add(const FQuestInstance& Instance, int32 LogIndex, const FGameplayTag& QuestType);
+	void UpdateState(int32 LogIndex, const FGameplayTag& OldState, const FGameplayTag& NewState);
+	void Rebuild(const TArray<FQuestInstance>& Log, TFunctionRef<FGameplayTag(FName)> GetQuestType);
+	void Reset();
+
+	/** @return log index or INDEX_NONE */
+	int32 Find(FName QuestID) const;
+
+	int32 NumInState(const FGameplayTag& State) const;
+	void GetByState(const TArray<FQuestInstance>& Log, const FGameplayTag& State, TArray<FName>& OutQuestIDs) const;
+	void GetByType(const TArray<FQuestInstance>& Log, const FGameplayTag& QuestType, TArray<FName>& OutQuestIDs) const;
+
+private:
+	static void GetBucket(const TArray<FQuestInstance>& Log, const TSet<int32>* Bucket, TArray<FName>& OutQuestIDs);
+
+	TMap<FName, int32> IndexByID;
+	TMap<FGameplayTag, TSet<int32>> ByState;
+	TMap<FGameplayTag, TSet<int32>> ByType;
+};
+
 /**
  * Per-player quest tracking component.
  * Maintains the quest log (replicated) and player tags for prerequisite checks.
@@ -30,21 +58,33 @@ public:
 	// ============================================================================
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 	// ============================================================================
 	// QUEST LOG ACCESS
 	// ============================================================================
 
-	/** Add a quest instance to the log */
+	/** Add a quest instance to the log (one entry per QuestID) */
 	void AddQuestInstance(const FQuestInstance& Instance);
 
-	/** Find quest instance by ID (mutable) */
+	/** Find quest instance by ID (mutable). Change StateTag through SetQuestState so the state buckets follow. */
 	FQuestInstance* FindQuestInstance(FName QuestID);
 
 	/** Find quest instance by ID (const) */
 	const FQuestInstance* FindQuestInstance(FName QuestID) const;
 
+	/** Set a logged quest's state. @return false if the quest is not in the log */
+	bool SetQuestState(FName QuestID, const FGameplayTag& NewState);
+
+	/** Quest IDs in a state (Quest.State.*), in log order */
+	UFUNCTION(BlueprintPure, Category = "Quest|Tracker")
+	TArray<FName> GetQuestIDsByState(FGameplayTag State) const;
+
+	/** Quest IDs of a type (Quest.Type.*), in log order */
+	UFUNCTION(BlueprintPure, Category = "Quest|Tracker")
+	TArray<FName> GetQuestIDsByType(FGameplayTag QuestType) const;
+
 	/** Get the full quest log */
 	UFUNCTION(BlueprintPure, Category = "Quest|Tracker")
 	const TArray<FQuestInstance>& GetQuestLog() const { return QuestLog; }
@@ -110,6 +150,9 @@ private:
 	UPROPERTY(ReplicatedUsing = OnRep_QuestLog)
 	TArray<FQuestInstance> QuestLog;
 
+	/** Lookup tables over QuestLog - rebuilt on replication */
+	FQuestLogIndex QuestLogIndex;
+
 	/** Player tags for prerequisite checks — replicated to owning client */
 	UPROPERTY(ReplicatedUsing = OnRep_PlayerTags)
 	FGameplayTagContainer PlayerTags;
@@ -128,4 +171,7 @@ private:
 
 	/** Cache subsystem reference */
 	void CacheSubsystem();
+
+	/** Quest type from the registry (empty if unknown) */
+	FGameplayTag LookupQuestType(FName QuestID);
 };
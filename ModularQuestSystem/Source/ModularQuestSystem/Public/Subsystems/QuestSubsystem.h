@@ -14,6 +14,37 @@ class UEventBusSubsystem;
 class UQuestTrackerComponent;
 class UDataTable;
 
+/**
+ * Prerequisite graph over the quest registry.
+ * Edges run from a prerequisite to the quests it gates: PrerequisiteQuestIDs, the previous
+ * quest in a chain's QuestSequence, and PrerequisiteTags (indexed by tag). When something
+ * changes, only the quests on the far side of its edges need re-evaluating.
+ */
+class MODULARQUESTSYSTEM_API FQuestDependencyGraph
+{
+public:
+	void Rebuild(const TMap<FName, FQuestData>& Quests, const TMap<FName, FQuestChain>& Chains);
+	void Reset();
+
+	/** Quests gated on QuestID being turned in */
+	TConstArrayView<FName> GetQuestDependents(FName QuestID) const;
+
+	/** Quests with a prerequisite tag that Tag satisfies (Tag itself or one of its parents) */
+	void GetTagDependents(const FGameplayTag& Tag, TArray<FName>& OutQuests) const;
+
+	/** Previous quest in the quest's chain (NAME_None if first or unchained) */
+	FName GetChainPredecessor(FName QuestID) const;
+
+	/** Quests on a prerequisite cycle - they can never become available */
+	const TArray<FName>& GetCyclicQuests() const { return CyclicQuests; }
+
+private:
+	TMap<FName, TArray<FName>> QuestDependents;
+	TMap<FGameplayTag, TArray<FName>> TagDependents;
+	TMap<FName, FName> ChainPredecessors;
+	TArray<FName> CyclicQuests;
+};
+
 /**
  * Central quest registry and lifecycle manager.
  * Owns quest definitions (from DataTable), manages state transitions,
@@ -61,6 +92,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Quest|Delegates")
 	FOnQuestAvailable OnQuestAvailable;
 
+	/** Diff of each availability refresh (OnQuestAvailable still fires per quest) */
+	UPROPERTY(BlueprintAssignable, Category = "Quest|Delegates")
+	FOnQuestAvailabilityChanged OnQuestAvailabilityChanged;
+
 	UPROPERTY(BlueprintAssignable, Category = "Quest|Delegates")
 	FOnQuestObjectiveProgress OnQuestObjectiveProgress;
 
@@ -96,6 +131,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Quest|Registry")
 	TArray<FName> GetQuestsByType(FGameplayTag QuestType) const;
 
+	/** Type tag of a registered quest (empty if unknown) */
+	UFUNCTION(BlueprintPure, Category = "Quest|Registry")
+	FGameplayTag GetQuestType(FName QuestID) const;
+
 	// ============================================================================
 	// QUEST LIFECYCLE
 	// ============================================================================
@@ -128,7 +167,7 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Quest|Query")
 	FGameplayTag GetQuestState(FName QuestID, AActor* Player) const;
 
-	/** Check if player meets prerequisites for a quest */
+	/** Check if player meets prerequisites for a quest (prerequisite quests, chain predecessor, tags) */
 	UFUNCTION(BlueprintPure, Category = "Quest|Query")
 	bool MeetsPrerequisites(FName QuestID, AActor* Player) const;
 
@@ -144,6 +183,23 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Quest|Query")
 	float GetQuestProgress(FName QuestID, AActor* Player) const;
 
+	// ============================================================================
+	// AVAILABILITY
+	// ============================================================================
+
+	/** Full pass over the registry (tracker registration, table load, save restore). Routine changes re-evaluate only their dependents. */
+	UFUNCTION(BlueprintCallable, Category = "Quest|Availability")
+	void RefreshQuestAvailability(AActor* Player);
+
+	/** Re-evaluate quests gated on a player tag (level, reputation, flags). Called by UQuestTrackerComponent. */
+	void NotifyPlayerTagChanged(AActor* Player, const FGameplayTag& Tag);
+
+	/** Server: track a player's quest log for registry/save driven refreshes and run its first full pass. Called by UQuestTrackerComponent. */
+	void RegisterTracker(UQuestTrackerComponent* Tracker);
+
+	/** Called by UQuestTrackerComponent on EndPlay */
+	void UnregisterTracker(UQuestTrackerComponent* Tracker);
+
 private:
 	// ============================================================================
 	// INTERNAL STATE
@@ -152,9 +208,22 @@ private:
 	/** Quest definition registry */
 	TMap<FName, FQuestData> QuestRegistry;
 
+	/** Quest type -> registered quest IDs */
+	TMap<FGameplayTag, TArray<FName>> QuestIDsByType;
+
 	/** Quest chain registry */
 	TMap<FName, FQuestChain> ChainRegistry;
 
+	/** Built from both registries on first use after either changes */
+	mutable FQuestDependencyGraph DependencyGraph;
+	mutable bool bDependencyGraphDirty = true;
+
+	/** Server-side trackers, re-evaluated when definitions load or a save is restored */
+	TArray<TWeakObjectPtr<UQuestTrackerComponent>> RegisteredTrackers;
+
+	/** Bound to USaveableRegistrySubsystem::OnStateRestored */
+	FDelegateHandle StateRestoredHandle;
+
 	/** Reverse lookup: ObjectiveTracker SetID -> {QuestID, Player} */
 	TMap<FGuid, TPair<FName, TWeakObjectPtr<AActor>>> SetIDToQuestMap;
 
@@ -170,6 +239,9 @@ private:
 	// ============================================================================
 
 	void CacheSubsystems();
+
+	/** Add or replace a definition, keeping QuestIDsByType in step */
+	void AddToRegistry(const FQuestData& QuestDef);
 	UQuestTrackerComponent* GetTrackerComponent(AActor* Player) const;
 
 	/** Change quest state and broadcast delegates */
@@ -194,6 +266,11 @@ private:
 	/** Unregister SetID mapping */
 	void UnregisterSetIDMapping(const FGuid& SetID);
 
-	/** Check and unlock newly available quests after a state change */
-	void RefreshQuestAvailability(AActor* Player);
+	const FQuestDependencyGraph& GetDependencyGraph() const;
+
+	/** Unlock candidates (quests with no log entry yet) whose prerequisites are now met, then broadcast the diff */
+	void EvaluateAvailability(AActor* Player, TConstArrayView<FName> Candidates);
+
+	/** EvaluateAvailability for every registered tracker; empty Candidates = full registry pass */
+	void EvaluateAvailabilityForTrackers(TConstArrayView<FName> Candidates = {});
 };
@@ -1,7 +1,14 @@
 #include "MasterSaveSubsystem.h"
 
 #include "UserSettingsSaveModule.h"
+#include "SaveContainer.h"
+#include "SaveDeltaLog.h"
 #include "Kismet/GameplayStatics.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "Async/Async.h"
+#include "Misc/Crc.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 #include "Subsystems/SaveSystem/SaveableRegistrySubsystem.h"
 #include "Interfaces/ModularSaveGameSystem/SaveableInterface.h"
 #include "Lib/Data/Tags/WW_TagLibrary.h"
@@ -16,6 +23,8 @@ void UMasterSaveSubsystem::Initialize(FSubsystemCollectionBase& Collection)
     
     CurrentSaveGame = nullptr;
     CurrentSaveSlotName = DEFAULT_SAVE_SLOT;
+
+    RefreshSlotCatalogue();
 }
 
 void UMasterSaveSubsystem::Deinitialize()
@@ -32,6 +41,13 @@ bool UMasterSaveSubsystem::SaveGame(const FString& SaveSlotName, bool bAsync)
         return false;
     }
 
+    // Checked before SaveSubsystemState so a rejected save leaves the dirty flags alone
+    if (bBackgroundSaveInProgress)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MasterSaveSubsystem::SaveGame - A background save is still running, save rejected"));
+        return false;
+    }
+
     FString SlotName = GetSaveSlotName(SaveSlotName);
     CurrentSaveGame->SaveSlotName = SlotName;
     CurrentSaveGame->UpdateTimestamp();
@@ -45,6 +61,15 @@ bool UMasterSaveSubsystem::SaveGame(const FString& SaveSlotName, bool bAsync)
 bool UMasterSaveSubsystem::LoadGame(const FString& SaveSlotName)
 {
     FString SlotName = GetSaveSlotName(SaveSlotName);
+
+    // The in-flight base is written under CurrentSaveGame's new CheckpointId and drops the delta log -
+    // swapping CurrentSaveGame now would key every later incremental save to a log the next load ignores
+    if (bBackgroundSaveInProgress)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MasterSaveSubsystem::LoadGame - A background save is still running, load of '%s' rejected"), *SlotName);
+        OnLoadComplete.Broadcast(false, SlotName);
+        return false;
+    }
     
     CurrentSaveGame = LoadGameFromSlot(SlotName);
     
@@ -54,9 +79,21 @@ bool UMasterSaveSubsystem::LoadGame(const FString& SaveSlotName)
         CurrentSaveGame->ValidateAllModules();
         CurrentSaveGame->MigrateAllModules();
 
+        // Incremental saves can keep appending to the loaded base + log (chunk CRCs are unknown, so
+        // the first one rewrites the small chunks); saves without a checkpoint need a full save first
+        CheckpointChunkCrcs.Reset();
+        CheckpointSlotName = CurrentSaveGame->CheckpointId.IsValid() ? SlotName : FString();
+        CheckpointWorldRevision = GetWorldStateModule()->GetStructuralRevision();
+        GetWorldStateModule()->ResetUnloggedActorStates();
+
         // Restore subsystem-type saveables after successful load
         LoadSubsystemState();
 
+        if (USaveableRegistrySubsystem* Registry = USaveableRegistrySubsystem::Get(this))
+        {
+            Registry->OnStateRestored.Broadcast();
+        }
+
         OnLoadComplete.Broadcast(true, SlotName);
         return true;
     }
@@ -78,6 +115,13 @@ bool UMasterSaveSubsystem::QuickLoad()
 UMasterSaveGame* UMasterSaveSubsystem::CreateNewMasterSave(const FString& SaveSlotName)
 {
     FString SlotName = GetSaveSlotName(SaveSlotName);
+
+    // Same hazard as LoadGame - the background save still owns the checkpoint state
+    if (bBackgroundSaveInProgress)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MasterSaveSubsystem::CreateNewMasterSave - A background save is still running, '%s' not created"), *SlotName);
+        return nullptr;
+    }
     
     CurrentSaveGame = Cast<UMasterSaveGame>(UGameplayStatics::CreateSaveGameObject(UMasterSaveGame::StaticClass()));
     
@@ -101,6 +145,10 @@ UModularSaveData* UMasterSaveSubsystem::GetOrCreateModuleByClass(TSubclassOf<UMo
     if (!CurrentSaveGame)
     {
         CurrentSaveGame = CreateNewMasterSave();
+        if (!CurrentSaveGame)
+        {
+            return nullptr;
+        }
     }
 
     UModularSaveData* Module = CurrentSaveGame->GetModuleByClass(ModuleClass);
@@ -136,31 +184,35 @@ bool UMasterSaveSubsystem::DoesSaveExist(const FString& SaveSlotName) const
 bool UMasterSaveSubsystem::DeleteSave(const FString& SaveSlotName)
 {
     FString SlotName = GetSaveSlotName(SaveSlotName);
+    FSaveDeltaLog::Delete(SlotName);
+    FSaveMetadataSidecar::Delete(SlotName);
+    SlotCatalogue.Remove(SlotName);
+    if (CheckpointSlotName == SlotName)
+    {
+        CheckpointSlotName.Reset();
+    }
     return UGameplayStatics::DeleteGameInSlot(SlotName, USER_INDEX);
 }
 
 TArray<FString> UMasterSaveSubsystem::GetAllSaveSlots() const
 {
     TArray<FString> SaveSlots;
+    SlotCatalogue.GetKeys(SaveSlots);
     return SaveSlots;
 }
 
 bool UMasterSaveSubsystem::GetSaveMetadata(const FString& SaveSlotName, FDateTime& OutTimestamp, int32& OutVersion, FString& OutDescription) const
 {
-    FString SlotName = GetSaveSlotName(SaveSlotName);
-    
-    if (USaveGame* LoadedSave = UGameplayStatics::LoadGameFromSlot(SlotName, USER_INDEX))
+    FSaveSlotMetadata Metadata;
+    if (!GetSlotMetadata(SaveSlotName, Metadata))
     {
-        if (UMasterSaveGame* MasterSave = Cast<UMasterSaveGame>(LoadedSave))
-        {
-            OutTimestamp = MasterSave->SaveTimestamp;
-            OutVersion = MasterSave->MasterSaveVersion;
-            OutDescription = MasterSave->SaveDescription;
-            return true;
-        }
+        return false;
     }
 
-    return false;
+    OutTimestamp = Metadata.SaveTimestamp;
+    OutVersion = Metadata.MasterSaveVersion;
+    OutDescription = Metadata.SaveDescription;
+    return true;
 }
 
 FString UMasterSaveSubsystem::GeneratePlayerID(int32 PlayerIndex)
@@ -191,16 +243,93 @@ bool UMasterSaveSubsystem::SaveGameToSlot(UMasterSaveGame* SaveGame, const FStri
         return false;
     }
 
+    // A second writer on the slot could leave a base whose CheckpointId differs from CurrentSaveGame's,
+    // and every delta batch appended afterwards would be ignored on load
+    if (bBackgroundSaveInProgress)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MasterSaveSubsystem::SaveGameToSlot - A background save is still running, '%s' not written"), *SaveSlotName);
+        return false;
+    }
+
+    ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+    if (!SaveSystem)
+    {
+        return false;
+    }
+
+    // Every full save starts a new checkpoint for the slot's delta log
+    SaveGame->CheckpointId = FGuid::NewGuid();
+
+    // UObject access stays on the game thread; compression and I/O don't need it
+    TArray<FSaveContainerChunkPayload> Chunks;
+    FSaveContainer::SerializeChunks(SaveGame, Chunks);
+    const bool bIsCheckpoint = SaveGame == CurrentSaveGame;
+    if (bIsCheckpoint)
+    {
+        RecordCheckpoint(SaveSlotName, Chunks);
+    }
+
+    FSaveSlotMetadata Metadata = FSaveMetadataSidecar::FromSaveGame(SaveGame, 0);
+    Metadata.SaveSlotName = SaveSlotName;
+
     if (bAsync)
     {
-        FAsyncSaveGameToSlotDelegate SaveDelegate;
-        SaveDelegate.BindUObject(this, &UMasterSaveSubsystem::OnAsyncSaveComplete);
-        UGameplayStatics::AsyncSaveGameToSlot(SaveGame, SaveSlotName, USER_INDEX, SaveDelegate);
+        // Held until the game-thread completion: an incremental save appended meanwhile would be
+        // deleted together with the old log once the new base is written
+        bBackgroundSaveInProgress = true;
+
+        TWeakObjectPtr<UMasterSaveSubsystem> WeakThis(this);
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, SaveSystem, Chunks = MoveTemp(Chunks), SaveSlotName, Metadata, bIsCheckpoint]() mutable
+        {
+            TArray<uint8> Bytes;
+            FSaveContainer::Assemble(Chunks, Bytes);
+            const bool bSuccess = SaveSystem->SaveGame(false, *SaveSlotName, USER_INDEX, Bytes);
+            if (bSuccess)
+            {
+                FSaveDeltaLog::Delete(SaveSlotName);
+                Metadata.SaveSizeBytes = Bytes.Num();
+                FSaveMetadataSidecar::Write(Metadata);
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, SaveSlotName, Metadata, bSuccess, bIsCheckpoint]()
+            {
+                if (UMasterSaveSubsystem* This = WeakThis.Get())
+                {
+                    This->bBackgroundSaveInProgress = false;
+                    if (bSuccess)
+                    {
+                        This->SlotCatalogue.Add(SaveSlotName, Metadata);
+                        if (bIsCheckpoint)
+                        {
+                            This->CheckpointBaseBytes = Metadata.SaveSizeBytes;
+                        }
+                    }
+                    This->OnAsyncSaveComplete(SaveSlotName, USER_INDEX, bSuccess);
+                }
+            });
+        });
         return true;
     }
     else
     {
-        bool bSuccess = UGameplayStatics::SaveGameToSlot(SaveGame, SaveSlotName, USER_INDEX);
+        TArray<uint8> Bytes;
+        FSaveContainer::Assemble(Chunks, Bytes);
+        bool bSuccess = SaveSystem->SaveGame(false, *SaveSlotName, USER_INDEX, Bytes);
+        if (bSuccess)
+        {
+            FSaveDeltaLog::Delete(SaveSlotName);
+            Metadata.SaveSizeBytes = Bytes.Num();
+            FSaveMetadataSidecar::Write(Metadata);
+            SlotCatalogue.Add(SaveSlotName, Metadata);
+            if (bIsCheckpoint)
+            {
+                CheckpointBaseBytes = Bytes.Num();
+            }
+        }
+        else
+        {
+            CheckpointSlotName.Reset();
+        }
         OnSaveComplete.Broadcast(bSuccess, SaveSlotName);
         return bSuccess;
     }
@@ -208,16 +337,47 @@ bool UMasterSaveSubsystem::SaveGameToSlot(UMasterSaveGame* SaveGame, const FStri
 
 UMasterSaveGame* UMasterSaveSubsystem::LoadGameFromSlot(const FString& SaveSlotName)
 {
-    if (USaveGame* LoadedSave = UGameplayStatics::LoadGameFromSlot(SaveSlotName, USER_INDEX))
+    ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+    TArray<uint8> Bytes;
+    if (!SaveSystem || !SaveSystem->LoadGame(false, *SaveSlotName, USER_INDEX, Bytes))
     {
-        return Cast<UMasterSaveGame>(LoadedSave);
+        return nullptr;
     }
 
-    return nullptr;
+    if (FSaveContainer::IsContainer(Bytes))
+    {
+        TArray<FString> CorruptChunks;
+        UMasterSaveGame* LoadedSave = FSaveContainer::Read(Bytes, &CorruptChunks);
+        if (CorruptChunks.Num() > 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MasterSaveSubsystem::LoadGameFromSlot - '%s' has %d corrupt chunk(s): %s"),
+                *SaveSlotName, CorruptChunks.Num(), *FString::Join(CorruptChunks, TEXT(", ")));
+        }
+
+        // Replay incremental saves made on top of this base
+        TArray<FSaveDeltaRecord> DeltaRecords;
+        CheckpointLogBytes = 0;
+        CheckpointBaseBytes = Bytes.Num();
+        if (LoadedSave && LoadedSave->CheckpointId.IsValid()
+            && FSaveDeltaLog::ReadRecords(SaveSlotName, LoadedSave->CheckpointId, DeltaRecords, &CheckpointLogBytes))
+        {
+            FSaveDeltaLog::Apply(LoadedSave, DeltaRecords);
+            UE_LOG(LogTemp, Log, TEXT("MasterSaveSubsystem::LoadGameFromSlot - Replayed %d delta record(s) for '%s'"),
+                DeltaRecords.Num(), *SaveSlotName);
+        }
+        return LoadedSave;
+    }
+
+    // Saves written before the chunked container
+    return Cast<UMasterSaveGame>(UGameplayStatics::LoadGameFromMemory(Bytes));
 }
 
 void UMasterSaveSubsystem::OnAsyncSaveComplete(const FString& SlotName, const int32 UserIndex, bool bSuccess)
 {
+    if (!bSuccess)
+    {
+        CheckpointSlotName.Reset();
+    }
     OnSaveComplete.Broadcast(bSuccess, SlotName);
 }
 
@@ -231,6 +391,11 @@ void UMasterSaveSubsystem::OnAsyncLoadComplete(const FString& SlotName, const in
         CurrentSaveSlotName = SlotName;
         CurrentSaveGame->ValidateAllModules();
         CurrentSaveGame->MigrateAllModules();
+
+        if (USaveableRegistrySubsystem* Registry = USaveableRegistrySubsystem::Get(this))
+        {
+            Registry->OnStateRestored.Broadcast();
+        }
     }
 
     OnLoadComplete.Broadcast(bSuccess, SlotName);
@@ -276,32 +441,499 @@ bool UMasterSaveSubsystem::SaveWorldState(const FString& LevelName)
         if (!SaveType.MatchesTag(FWWTagLibrary::Save_Category_Actor())) continue;
 
         FSaveRecord Record;
-        if (ISaveableInterface::Execute_SaveState(Saveable, Record))
+        FActorSaveEnvelope Envelope;
+        if (ISaveableInterface::Execute_SaveState(Saveable, Record)
+            && UWorldStateSaveModule::AssembleEnvelope(Record, LevelName, Envelope))
         {
-            // Build envelope from the record's binary data
-            if (Record.BinaryData.Num() > 0)
+            WorldModule->SaveActorState(Envelope);
+            SavedCount++;
+        }
+    }
+
+    // Clear dirty flags on all saved objects
+    if (SavedCount > 0)
+    {
+        Registry->MarkAllClean();
+    }
+
+    return SavedCount > 0;
+}
+
+// ============================================================================
+// BACKGROUND SAVE
+// ============================================================================
+
+const int64 UMasterSaveSubsystem::DELTA_COMPACTION_BASE_DIVISOR = 8;
+const int64 UMasterSaveSubsystem::DELTA_COMPACTION_MIN_BYTES = 64 * 1024;
+
+namespace MasterSaveBackground
+{
+    /** Everything the worker needs - owned by the task, never touched by the game thread after launch */
+    struct FJob
+    {
+        FString SlotName;
+        FString LevelName;
+        FGuid CheckpointId;
+        TArray<FSaveRecord> ActorRecords;
+        TArray<FSaveContainerChunkPayload> Chunks;
+        FWorldStateLevels WorldLevels;
+        TArray<FActorSaveEnvelope> Envelopes;
+        TArray<FActorSaveEnvelope> LoggedEnvelopes;
+        FSaveSlotMetadata Metadata;
+        int64 LogBytes = 0;
+    };
+
+    using FJobRef = TSharedRef<FJob, ESPMode::ThreadSafe>;
+
+    /** Worker: decode the captured SaveState bytes into envelopes */
+    static void AssembleEnvelopes(FJob& Job)
+    {
+        Job.Envelopes.Reserve(Job.ActorRecords.Num());
+        for (const FSaveRecord& Record : Job.ActorRecords)
+        {
+            FActorSaveEnvelope Envelope;
+            if (UWorldStateSaveModule::AssembleEnvelope(Record, Job.LevelName, Envelope))
+            {
+                Job.Envelopes.Add(MoveTemp(Envelope));
+            }
+        }
+        Job.ActorRecords.Empty();
+    }
+
+    /** Worker: forward a progress value to OnSaveProgress on the game thread */
+    static void ReportProgress(const TWeakObjectPtr<UMasterSaveSubsystem>& WeakThis, const FString& SlotName, float Progress)
+    {
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, SlotName, Progress]()
+        {
+            if (UMasterSaveSubsystem* This = WeakThis.Get())
             {
-                FMemoryReader MemoryReader(Record.BinaryData, true);
-                FActorSaveEnvelope Envelope;
-                FActorSaveEnvelope::StaticStruct()->SerializeBin(MemoryReader, &Envelope);
+                This->OnSaveProgress.Broadcast(SlotName, Progress);
+            }
+        });
+    }
+}
+
+void UMasterSaveSubsystem::CollectDirtyActorRecords(TArray<FSaveRecord>& OutRecords)
+{
+    USaveableRegistrySubsystem* Registry = USaveableRegistrySubsystem::Get(this);
+    if (!Registry)
+    {
+        return;
+    }
+
+    // The bytes SaveState produced are kept as-is, never decoded on the game thread
+    for (UObject* Saveable : Registry->GetDirtySaveables())
+    {
+        if (!Saveable || !IsValid(Saveable)) continue;
+
+        FGameplayTag SaveType = ISaveableInterface::Execute_GetSaveType(Saveable);
+        if (!SaveType.MatchesTag(FWWTagLibrary::Save_Category_Actor())) continue;
+
+        FSaveRecord& Record = OutRecords.AddDefaulted_GetRef();
+        if (ISaveableInterface::Execute_SaveState(Saveable, Record) && Record.BinaryData.Num() > 0)
+        {
+            Registry->MarkSaveableClean(Saveable);
+        }
+        else
+        {
+            OutRecords.Pop(EAllowShrinking::No);
+        }
+    }
+}
+
+void UMasterSaveSubsystem::RecordCheckpoint(const FString& SlotName, const TArray<FSaveContainerChunkPayload>& Chunks)
+{
+    const FString WorldModuleKey = UWorldStateSaveModule::StaticClass()->GetName();
+
+    UWorldStateSaveModule* WorldModule = GetWorldStateModule();
+
+    CheckpointSlotName = SlotName;
+    CheckpointWorldRevision = WorldModule->GetStructuralRevision();
+    CheckpointLogBytes = 0;
+    CheckpointBaseBytes = 0;
+    WorldModule->ResetUnloggedActorStates();
+    CheckpointChunkCrcs.Reset();
+    for (const FSaveContainerChunkPayload& Chunk : Chunks)
+    {
+        if (Chunk.Name != WorldModuleKey)
+        {
+            CheckpointChunkCrcs.Add(Chunk.Name, FCrc::MemCrc32(Chunk.Bytes.GetData(), Chunk.Bytes.Num()));
+        }
+    }
+}
+
+bool UMasterSaveSubsystem::SaveGameInBackground(const FString& SaveSlotName, const FString& LevelName)
+{
+    if (!CurrentSaveGame || bBackgroundSaveInProgress)
+    {
+        return false;
+    }
+
+    ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+    if (!SaveSystem)
+    {
+        return false;
+    }
+
+    const double SnapshotStart = FPlatformTime::Seconds();
+
+    const FString SlotName = GetSaveSlotName(SaveSlotName);
+    CurrentSaveGame->SaveSlotName = SlotName;
+    CurrentSaveGame->CheckpointId = FGuid::NewGuid();
+    CurrentSaveGame->UpdateTimestamp();
+
+    SaveSubsystemState();
+
+    UWorldStateSaveModule* WorldModule = GetWorldStateModule();
+
+    MasterSaveBackground::FJobRef Job = MakeShared<MasterSaveBackground::FJob, ESPMode::ThreadSafe>();
+    Job->SlotName = SlotName;
+    Job->LevelName = LevelName;
+    CollectDirtyActorRecords(Job->ActorRecords);
+
+    // Small modules are serialized now; the world-state chunk gets its header here and its levels on the worker
+    FSaveContainer::SerializeChunks(CurrentSaveGame, Job->Chunks, WorldModule);
+    RecordCheckpoint(SlotName, Job->Chunks);
+    {
+        FSaveContainerChunkPayload& WorldChunk = Job->Chunks.AddDefaulted_GetRef();
+        WorldChunk.Name = WorldModule->GetClass()->GetName();
+        WorldChunk.ClassPath = WorldModule->GetClass()->GetPathName();
+
+        FMemoryWriter Writer(WorldChunk.Bytes, true);
+        FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+        WorldModule->SerializeHeader(Ar);
+    }
+    Job->WorldLevels = WorldModule->GetLevelsSnapshot();
+    Job->Metadata = FSaveMetadataSidecar::FromSaveGame(CurrentSaveGame, 0);
+
+    bBackgroundSaveInProgress = true;
+
+    UE_LOG(LogTemp, Log, TEXT("MasterSaveSubsystem::SaveGameInBackground - Snapshot of %d dirty actor(s) took %.3f ms on the game thread"),
+        Job->ActorRecords.Num(), (FPlatformTime::Seconds() - SnapshotStart) * 1000.0);
 
-                if (Envelope.IsValid())
+    OnSaveProgress.Broadcast(SlotName, 0.0f);
+
+    TWeakObjectPtr<UMasterSaveSubsystem> WeakThis(this);
+    TWeakObjectPtr<UWorldStateSaveModule> WeakWorldModule(WorldModule);
+
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, WeakWorldModule, SaveSystem, Job]()
+    {
+        MasterSaveBackground::AssembleEnvelopes(*Job);
+        MasterSaveBackground::ReportProgress(WeakThis, Job->SlotName, 0.25f);
+
+        // Merge into the snapshot - the touched level is cloned here, the module's copy is never written
+        if (Job->Envelopes.Num() > 0)
+        {
+            FWorldStateLevelRef* Level = Job->WorldLevels.Find(Job->LevelName);
+            if (Level)
+            {
+                *Level = MakeShared<FActorSaveEnvelopeMap, ESPMode::ThreadSafe>(**Level);
+            }
+            else
+            {
+                Level = &Job->WorldLevels.Add(Job->LevelName, MakeShared<FActorSaveEnvelopeMap, ESPMode::ThreadSafe>());
+            }
+
+            for (const FActorSaveEnvelope& Envelope : Job->Envelopes)
+            {
+                (*Level)->Actors.Add(Envelope.ActorSaveID, Envelope);
+            }
+        }
+
+        // Finish the world-state chunk after the header written on the game thread
+        {
+            FMemoryWriter Writer(Job->Chunks.Last().Bytes, true, true);
+            FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+            UWorldStateSaveModule::SerializeLevels(Ar, Job->WorldLevels);
+        }
+
+        // Drop the shared level maps before the game thread writes to them again
+        Job->WorldLevels.Empty();
+        MasterSaveBackground::ReportProgress(WeakThis, Job->SlotName, 0.5f);
+
+        // Compression + checksums
+        TArray<uint8> Bytes;
+        FSaveContainer::Assemble(Job->Chunks, Bytes);
+        Job->Chunks.Empty();
+        MasterSaveBackground::ReportProgress(WeakThis, Job->SlotName, 0.8f);
+
+        // Disk I/O - the new base supersedes the slot's delta log
+        const bool bSuccess = SaveSystem->SaveGame(false, *Job->SlotName, USER_INDEX, Bytes);
+        if (bSuccess)
+        {
+            FSaveDeltaLog::Delete(Job->SlotName);
+            Job->Metadata.SaveSizeBytes = Bytes.Num();
+            FSaveMetadataSidecar::Write(Job->Metadata);
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, WeakWorldModule, Job, bSuccess]()
+        {
+            if (UMasterSaveSubsystem* This = WeakThis.Get())
+            {
+                if (bSuccess)
                 {
-                    Envelope.LevelName = LevelName;
-                    WorldModule->SaveActorState(Envelope);
-                    SavedCount++;
+                    This->CheckpointBaseBytes = Job->Metadata.SaveSizeBytes;
                 }
+                This->FinishBackgroundSave(Job->SlotName, WeakWorldModule.Get(), MoveTemp(Job->Envelopes), Job->Metadata, bSuccess);
             }
+        });
+    });
+
+    return true;
+}
+
+bool UMasterSaveSubsystem::SaveGameIncremental(const FString& SaveSlotName, const FString& LevelName)
+{
+    if (!CurrentSaveGame || bBackgroundSaveInProgress)
+    {
+        return false;
+    }
+
+    const FString SlotName = GetSaveSlotName(SaveSlotName);
+    UWorldStateSaveModule* WorldModule = GetWorldStateModule();
+
+    // Full save instead when there is no base to build on, state was removed (deltas only upsert),
+    // or the log has grown enough to be worth compacting into a new base
+    const bool bNeedsCheckpoint = CheckpointSlotName != SlotName
+        || !CurrentSaveGame->CheckpointId.IsValid()
+        || WorldModule->GetStructuralRevision() != CheckpointWorldRevision
+        || CheckpointLogBytes >= FMath::Max(DELTA_COMPACTION_MIN_BYTES, CheckpointBaseBytes / DELTA_COMPACTION_BASE_DIVISOR);
+
+    if (bNeedsCheckpoint)
+    {
+        return SaveGameInBackground(SlotName, LevelName);
+    }
+
+    const double SnapshotStart = FPlatformTime::Seconds();
+
+    CurrentSaveGame->SaveSlotName = SlotName;
+    CurrentSaveGame->UpdateTimestamp();
+
+    SaveSubsystemState();
+
+    MasterSaveBackground::FJobRef Job = MakeShared<MasterSaveBackground::FJob, ESPMode::ThreadSafe>();
+    Job->SlotName = SlotName;
+    Job->LevelName = LevelName;
+    Job->CheckpointId = CurrentSaveGame->CheckpointId;
+    CollectDirtyActorRecords(Job->ActorRecords);
+
+    // SaveWorldState writes go straight into the module and clean their actors - log them too
+    WorldModule->CollectUnloggedActorStates(Job->LoggedEnvelopes);
+
+    // Small chunks go into the log only if their bytes changed since they were last written
+    TArray<FSaveContainerChunkPayload> Chunks;
+    FSaveContainer::SerializeChunks(CurrentSaveGame, Chunks, WorldModule);
+    for (FSaveContainerChunkPayload& Chunk : Chunks)
+    {
+        const uint32 Crc = FCrc::MemCrc32(Chunk.Bytes.GetData(), Chunk.Bytes.Num());
+        uint32& LastCrc = CheckpointChunkCrcs.FindOrAdd(Chunk.Name, ~Crc);
+        if (LastCrc != Crc)
+        {
+            LastCrc = Crc;
+            Job->Chunks.Add(MoveTemp(Chunk));
         }
     }
 
-    // Clear dirty flags on all saved objects
-    if (SavedCount > 0)
+    // The base file is unchanged, so the catalogue's size still applies
+    Job->Metadata = FSaveMetadataSidecar::FromSaveGame(CurrentSaveGame, 0);
+    if (const FSaveSlotMetadata* Existing = SlotCatalogue.Find(SlotName))
     {
-        Registry->MarkAllClean();
+        Job->Metadata.SaveSizeBytes = Existing->SaveSizeBytes;
     }
 
-    return SavedCount > 0;
+    bBackgroundSaveInProgress = true;
+
+    UE_LOG(LogTemp, Log, TEXT("MasterSaveSubsystem::SaveGameIncremental - Snapshot of %d dirty actor(s), %d changed chunk(s) took %.3f ms on the game thread"),
+        Job->ActorRecords.Num(), Job->Chunks.Num(), (FPlatformTime::Seconds() - SnapshotStart) * 1000.0);
+
+    OnSaveProgress.Broadcast(SlotName, 0.0f);
+
+    TWeakObjectPtr<UMasterSaveSubsystem> WeakThis(this);
+    TWeakObjectPtr<UWorldStateSaveModule> WeakWorldModule(WorldModule);
+
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, WeakWorldModule, Job]()
+    {
+        MasterSaveBackground::AssembleEnvelopes(*Job);
+        MasterSaveBackground::ReportProgress(WeakThis, Job->SlotName, 0.5f);
+
+        TArray<FSaveDeltaRecord> Records;
+        Records.Reserve(Job->Chunks.Num() + 1);
+        for (FSaveContainerChunkPayload& Chunk : Job->Chunks)
+        {
+            FSaveDeltaRecord& Record = Records.AddDefaulted_GetRef();
+            Record.Type = ESaveDeltaRecordType::Chunk;
+            Record.Chunk = MoveTemp(Chunk);
+        }
+        Job->Chunks.Empty();
+
+        // Module writes first, then the freshly collected dirty actors, so the newer state wins on replay
+        TArray<FActorSaveEnvelope> LogEnvelopes = MoveTemp(Job->LoggedEnvelopes);
+        LogEnvelopes.Append(Job->Envelopes);
+        if (LogEnvelopes.Num() > 0)
+        {
+            FSaveDeltaRecord& Record = Records.AddDefaulted_GetRef();
+            Record.Type = ESaveDeltaRecordType::ActorEnvelopes;
+            Record.Chunk.Name = Job->LevelName;
+
+            FMemoryWriter Writer(Record.Chunk.Bytes, true);
+            FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+            FSaveDeltaLog::SerializeEnvelopes(Ar, LogEnvelopes);
+        }
+
+        const bool bSuccess = FSaveDeltaLog::AppendBatch(Job->SlotName, Job->CheckpointId, Records, &Job->LogBytes);
+        if (bSuccess)
+        {
+            FSaveMetadataSidecar::Write(Job->Metadata);
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, WeakWorldModule, Job, bSuccess]()
+        {
+            if (UMasterSaveSubsystem* This = WeakThis.Get())
+            {
+                if (bSuccess)
+                {
+                    This->CheckpointLogBytes = Job->LogBytes;
+                }
+                This->FinishBackgroundSave(Job->SlotName, WeakWorldModule.Get(), MoveTemp(Job->Envelopes), Job->Metadata, bSuccess);
+            }
+        });
+    });
+
+    return true;
+}
+
+void UMasterSaveSubsystem::FinishBackgroundSave(const FString& SlotName, UWorldStateSaveModule* WorldModule,
+    TArray<FActorSaveEnvelope>&& Envelopes, const FSaveSlotMetadata& Metadata, bool bSuccess)
+{
+    bBackgroundSaveInProgress = false;
+
+    // The module takes the envelopes even if the write failed - the saveables are already clean,
+    // so the next save must still carry this state
+    if (WorldModule && Envelopes.Num() > 0)
+    {
+        WorldModule->AdoptActorStates(MoveTemp(Envelopes));
+    }
+
+    // Nothing reliable to append to any more - the next incremental save writes a new base
+    if (bSuccess)
+    {
+        SlotCatalogue.Add(SlotName, Metadata);
+    }
+    else
+    {
+        CheckpointSlotName.Reset();
+    }
+
+    OnSaveProgress.Broadcast(SlotName, 1.0f);
+    OnSaveComplete.Broadcast(bSuccess, SlotName);
+}
+
+// ============================================================================
+// SLOT CATALOGUE
+// ============================================================================
+
+void UMasterSaveSubsystem::RefreshSlotCatalogue()
+{
+    TWeakObjectPtr<UMasterSaveSubsystem> WeakThis(this);
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis]()
+    {
+        TArray<FSaveSlotMetadata> Found;
+        FSaveMetadataSidecar::ReadAll(Found);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Found = MoveTemp(Found)]()
+        {
+            UMasterSaveSubsystem* This = WeakThis.Get();
+            if (!This)
+            {
+                return;
+            }
+
+            // A save that finished while the sidecars were being read is newer than what was read
+            TMap<FString, FSaveSlotMetadata> Refreshed;
+            Refreshed.Reserve(Found.Num());
+            for (const FSaveSlotMetadata& Metadata : Found)
+            {
+                const FSaveSlotMetadata* Current = This->SlotCatalogue.Find(Metadata.SaveSlotName);
+                Refreshed.Add(Metadata.SaveSlotName,
+                    Current && Current->SaveTimestamp > Metadata.SaveTimestamp ? *Current : Metadata);
+            }
+            for (const TPair<FString, FSaveSlotMetadata>& Pair : This->SlotCatalogue)
+            {
+                if (!Refreshed.Contains(Pair.Key))
+                {
+                    Refreshed.Add(Pair.Key, Pair.Value);
+                }
+            }
+            This->SlotCatalogue = MoveTemp(Refreshed);
+
+            This->OnSlotCatalogueRefreshed.Broadcast(This->SlotCatalogue.Num());
+        });
+    });
+}
+
+TArray<FSaveSlotMetadata> UMasterSaveSubsystem::GetSlotCatalogue() const
+{
+    TArray<FSaveSlotMetadata> Slots;
+    SlotCatalogue.GenerateValueArray(Slots);
+    Slots.Sort([](const FSaveSlotMetadata& A, const FSaveSlotMetadata& B)
+    {
+        return A.SaveTimestamp > B.SaveTimestamp;
+    });
+    return Slots;
+}
+
+bool UMasterSaveSubsystem::GetSlotMetadata(const FString& SaveSlotName, FSaveSlotMetadata& OutMetadata) const
+{
+    const FString SlotName = GetSaveSlotName(SaveSlotName);
+
+    if (const FSaveSlotMetadata* Cached = SlotCatalogue.Find(SlotName))
+    {
+        OutMetadata = *Cached;
+        return true;
+    }
+
+    if (FSaveMetadataSidecar::Read(SlotName, OutMetadata))
+    {
+        return true;
+    }
+
+    // No sidecar (written before sidecars existed) - read the save once and backfill it
+    ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+    TArray<uint8> Bytes;
+    if (!SaveSystem || !SaveSystem->LoadGame(false, *SlotName, USER_INDEX, Bytes))
+    {
+        return false;
+    }
+
+    if (FSaveContainer::IsContainer(Bytes))
+    {
+        // Container: inflate only the master chunk
+        FSaveContainerSaveInfo Info;
+        if (!FSaveContainer::ReadSaveInfo(Bytes, Info))
+        {
+            return false;
+        }
+
+        OutMetadata.SaveSlotName = SlotName;
+        OutMetadata.SaveTimestamp = Info.SaveTimestamp;
+        OutMetadata.MasterSaveVersion = Info.MasterSaveVersion;
+        OutMetadata.SaveDescription = Info.SaveDescription;
+        OutMetadata.LevelName = Info.LevelName;
+        OutMetadata.PlayTimeSeconds = Info.PlayTimeSeconds;
+        OutMetadata.SaveSizeBytes = Bytes.Num();
+    }
+    else if (UMasterSaveGame* MasterSave = Cast<UMasterSaveGame>(UGameplayStatics::LoadGameFromMemory(Bytes)))
+    {
+        OutMetadata = FSaveMetadataSidecar::FromSaveGame(MasterSave, Bytes.Num());
+        OutMetadata.SaveSlotName = SlotName;
+    }
+    else
+    {
+        return false;
+    }
+
+    FSaveMetadataSidecar::Write(OutMetadata);
+    return true;
 }
 
 // ============================================================================
@@ -337,7 +969,7 @@ bool UMasterSaveSubsystem::SaveSubsystemState()
         {
             FString SaveID = ISaveableInterface::Execute_GetSaveID(Saveable);
             CurrentSaveGame->SubsystemSaveRecords.Add(SaveID, Record);
-            ISaveableInterface::Execute_ClearDirty(Saveable);
+            Registry->MarkSaveableClean(Saveable);
             SavedCount++;
         }
     }
@@ -406,48 +1038,61 @@ bool UMasterSaveSubsystem::LoadWorldState(const FString& LevelName)
     UWorld* World = GetWorld();
     if (!World) return false;
 
-    TArray<FActorSaveEnvelope> Envelopes = WorldModule->GetAllActorsForLevel(LevelName);
-    if (Envelopes.Num() == 0)
+    const TMap<FString, FActorSaveEnvelope>* Envelopes = WorldModule->FindActorsForLevel(LevelName);
+    if (!Envelopes || Envelopes->Num() == 0)
     {
         OnWorldStateLoaded.Broadcast(LevelName);
         return true;
     }
 
-    // Sort envelopes by the actor SaveType: actors with lower priority numbers load first
+    // One pass over the world: saved identity (path name) -> actor, only for actors the save mentions.
+    // Restoring is then a map lookup per envelope instead of an actor scan per envelope.
+    TMap<FString, AActor*> ActorsBySaveID;
+    ActorsBySaveID.Reserve(Envelopes->Num());
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        FString PathName = It->GetPathName();
+        if (Envelopes->Contains(PathName))
+        {
+            ActorsBySaveID.Add(MoveTemp(PathName), *It);
+        }
+    }
+
+    // Destroy, LoadState and OnActorStateRestored handlers can save, remove or clear actor states -
+    // walk a snapshot of the IDs and re-find each envelope instead of iterating the live map
+    TArray<FString> SaveIDs;
+    Envelopes->GetKeys(SaveIDs);
+
     int32 RestoredCount = 0;
 
-    for (const FActorSaveEnvelope& Envelope : Envelopes)
+    for (const FString& SaveID : SaveIDs)
     {
-        if (!Envelope.IsValid()) continue;
+        const TMap<FString, FActorSaveEnvelope>* CurrentEnvelopes = WorldModule->FindActorsForLevel(LevelName);
+        const FActorSaveEnvelope* FoundEnvelope = CurrentEnvelopes ? CurrentEnvelopes->Find(SaveID) : nullptr;
+        if (!FoundEnvelope || !FoundEnvelope->IsValid()) continue;
+
+        // Copy - the map can rehash while this envelope is being restored
+        const FActorSaveEnvelope Envelope = *FoundEnvelope;
+
+        AActor* const* FoundActor = ActorsBySaveID.Find(Envelope.ActorSaveID);
+        AActor* Actor = FoundActor ? *FoundActor : nullptr;
 
         // Handle destroyed actors
         if (Envelope.bIsDestroyed)
         {
-            bool bFoundAndDestroyed = false;
-            // Find and destroy the actor
-            for (TActorIterator<AActor> It(World); It; ++It)
+            const bool bFoundAndDestroyed = IsValid(Actor);
+            if (bFoundAndDestroyed)
             {
-                if (It->GetPathName() == Envelope.ActorSaveID)
-                {
-                    It->Destroy();
-                    RestoredCount++;
-                    bFoundAndDestroyed = true;
-                    break;
-                }
+                Actor->Destroy();
+                RestoredCount++;
             }
             OnActorStateRestored.Broadcast(Envelope.ActorSaveID, bFoundAndDestroyed);
             continue;
         }
 
-        // Find the level-placed actor by path name
         bool bActorRestored = false;
-        for (TActorIterator<AActor> It(World); It; ++It)
+        if (IsValid(Actor) && Actor->GetClass()->ImplementsInterface(USaveableInterface::StaticClass()))
         {
-            AActor* Actor = *It;
-            if (Actor->GetPathName() != Envelope.ActorSaveID) continue;
-
-            if (!Actor->GetClass()->ImplementsInterface(USaveableInterface::StaticClass())) continue;
-
             // Serialize the envelope back to binary for the actor's LoadState
             TArray<uint8> BinaryData;
             FMemoryWriter MemoryWriter(BinaryData, true);
@@ -463,11 +1108,10 @@ bool UMasterSaveSubsystem::LoadWorldState(const FString& LevelName)
             {
                 RestoredCount++;
             }
-            break;
         }
         OnActorStateRestored.Broadcast(Envelope.ActorSaveID, bActorRestored);
     }
 
     OnWorldStateLoaded.Broadcast(LevelName);
     return RestoredCount > 0;
-}
\ No newline at end of file
+}
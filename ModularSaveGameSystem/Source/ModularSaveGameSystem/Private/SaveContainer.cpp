@@ -0,0 +1,733 @@
+// Copyright Windwalker Productions. All Rights Reserved.
+
+#include "SaveContainer.h"
+#include "MasterSaveGame.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Async/ParallelFor.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/Package.h"
+#include "UObject/SoftObjectPath.h"
+
+#if !UE_BUILD_SHIPPING
+#include "InventorySaveModule.h"
+#include "AbilitiesSaveModule.h"
+#include "CharacterSaveModule.h"
+#include "UserSettingsSaveModule.h"
+#include "WorldStateSaveModule.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+#endif
+
+const TCHAR* FSaveContainer::MasterChunkName = TEXT("$Master");
+const TCHAR* FSaveContainer::SubsystemRecordsChunkName = TEXT("$SubsystemRecords");
+const TCHAR* FSaveContainer::CheckpointChunkName = TEXT("$Checkpoint");
+
+// ============================================================================
+// ARCHIVE OPERATORS
+// ============================================================================
+
+FArchive& operator<<(FArchive& Ar, FSaveContainerHeader& Header)
+{
+	Ar << Header.Magic;
+	Ar << Header.FormatVersion;
+	Ar << Header.Flags;
+	Ar << Header.NumChunks;
+	Ar << Header.TocSize;
+	Ar << Header.TocCrc;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FSaveContainerChunkEntry& Entry)
+{
+	// Format name as a plain string so the table of contents never depends on FName serialization
+	FString Format = Entry.CompressionFormat.IsNone() ? FString() : Entry.CompressionFormat.ToString();
+
+	Ar << Entry.Name;
+	Ar << Entry.ClassPath;
+	Ar << Format;
+	Ar << Entry.Offset;
+	Ar << Entry.StoredSize;
+	Ar << Entry.UncompressedSize;
+	Ar << Entry.StoredCrc;
+	Ar << Entry.UncompressedCrc;
+
+	if (Ar.IsLoading())
+	{
+		Entry.CompressionFormat = Format.IsEmpty() ? NAME_None : FName(*Format);
+	}
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FSaveContainerSaveInfo& Info)
+{
+	Ar << Info.SaveSlotName;
+	Ar << Info.SaveTimestamp;
+	Ar << Info.MasterSaveVersion;
+	Ar << Info.SaveDescription;
+	Ar << Info.LevelName;
+	Ar << Info.PlayTimeSeconds;
+	return Ar;
+}
+
+// ============================================================================
+// CHUNK SERIALIZATION
+// ============================================================================
+
+namespace SaveContainerPrivate
+{
+	/**
+	 * Modules are pure save data, so every property is written (no ArIsSaveGame filter).
+	 * The SaveGame filter also applies inside nested structs and would drop un-flagged
+	 * fields such as FActorSaveEnvelope::ActorBinaryData.
+	 */
+	static void SerializeModule(UModularSaveData* Module, TArray<uint8>& OutBytes)
+	{
+		FMemoryWriter Writer(OutBytes, true);
+		FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+		Module->Serialize(Ar);
+	}
+
+	static bool DeserializeModule(UModularSaveData* Module, const TArray<uint8>& Bytes)
+	{
+		FMemoryReader Reader(Bytes, true);
+		FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+		Module->Serialize(Ar);
+		return !Ar.IsError();
+	}
+
+	static void SerializeSubsystemRecords(FArchive& Ar, TMap<FString, FSaveRecord>& Records)
+	{
+		int32 NumRecords = Records.Num();
+		Ar << NumRecords;
+
+		if (Ar.IsLoading())
+		{
+			Records.Reset();
+			Records.Reserve(NumRecords);
+			for (int32 i = 0; i < NumRecords && !Ar.IsError(); ++i)
+			{
+				FString SaveID;
+				Ar << SaveID;
+				FSaveRecord& Record = Records.Add(MoveTemp(SaveID));
+				FSaveRecord::StaticStruct()->SerializeBin(Ar, &Record);
+			}
+		}
+		else
+		{
+			for (TPair<FString, FSaveRecord>& Pair : Records)
+			{
+				Ar << Pair.Key;
+				FSaveRecord::StaticStruct()->SerializeBin(Ar, &Pair.Value);
+			}
+		}
+	}
+
+	static void CompressChunk(const FSaveContainerChunkPayload& Payload, FName CompressionFormat,
+		FSaveContainerChunkEntry& OutEntry, TArray<uint8>& OutStored)
+	{
+		const int32 RawSize = Payload.Bytes.Num();
+
+		OutEntry.Name = Payload.Name;
+		OutEntry.ClassPath = Payload.ClassPath;
+		OutEntry.UncompressedSize = RawSize;
+		OutEntry.UncompressedCrc = FCrc::MemCrc32(Payload.Bytes.GetData(), RawSize);
+		OutEntry.CompressionFormat = NAME_None;
+
+		bool bCompressed = false;
+		if (!CompressionFormat.IsNone() && RawSize > 0)
+		{
+			int32 CompressedSize = FCompression::CompressMemoryBound(CompressionFormat, RawSize);
+			OutStored.SetNumUninitialized(CompressedSize);
+
+			// Keep the compressed form only if it actually saves space
+			if (FCompression::CompressMemory(CompressionFormat, OutStored.GetData(), CompressedSize, Payload.Bytes.GetData(), RawSize)
+				&& CompressedSize < RawSize)
+			{
+				OutStored.SetNum(CompressedSize, EAllowShrinking::No);
+				OutEntry.CompressionFormat = CompressionFormat;
+				bCompressed = true;
+			}
+		}
+
+		if (!bCompressed)
+		{
+			OutStored = Payload.Bytes;
+		}
+
+		OutEntry.StoredSize = OutStored.Num();
+		OutEntry.StoredCrc = FCrc::MemCrc32(OutStored.GetData(), OutStored.Num());
+	}
+
+	static const FSaveContainerChunkEntry* FindEntry(const TArray<FSaveContainerChunkEntry>& Entries, const FString& Name)
+	{
+		return Entries.FindByPredicate([&Name](const FSaveContainerChunkEntry& Entry) { return Entry.Name == Name; });
+	}
+}
+
+// ============================================================================
+// WRITING
+// ============================================================================
+
+void FSaveContainer::SerializeChunks(const UMasterSaveGame* SaveGame, TArray<FSaveContainerChunkPayload>& OutChunks,
+	const UModularSaveData* SkipModule)
+{
+	OutChunks.Reset();
+	if (!SaveGame)
+	{
+		return;
+	}
+
+	OutChunks.Reserve(SaveGame->SaveModules.Num() + 3);
+
+	// Master info
+	{
+		FSaveContainerSaveInfo Info;
+		Info.SaveSlotName = SaveGame->SaveSlotName;
+		Info.SaveTimestamp = SaveGame->SaveTimestamp;
+		Info.MasterSaveVersion = SaveGame->MasterSaveVersion;
+		Info.SaveDescription = SaveGame->SaveDescription;
+		Info.LevelName = SaveGame->LevelName;
+		Info.PlayTimeSeconds = SaveGame->PlayTimeSeconds;
+
+		FSaveContainerChunkPayload& Chunk = OutChunks.AddDefaulted_GetRef();
+		Chunk.Name = MasterChunkName;
+		FMemoryWriter Writer(Chunk.Bytes, true);
+		Writer << Info;
+	}
+
+	// Subsystem records
+	{
+		FSaveContainerChunkPayload& Chunk = OutChunks.AddDefaulted_GetRef();
+		Chunk.Name = SubsystemRecordsChunkName;
+		FMemoryWriter Writer(Chunk.Bytes, true);
+		FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+		SaveContainerPrivate::SerializeSubsystemRecords(Ar, const_cast<UMasterSaveGame*>(SaveGame)->SubsystemSaveRecords);
+	}
+
+	// Checkpoint the slot's delta log builds on
+	{
+		FSaveContainerChunkPayload& Chunk = OutChunks.AddDefaulted_GetRef();
+		Chunk.Name = CheckpointChunkName;
+		FMemoryWriter Writer(Chunk.Bytes, true);
+		FGuid CheckpointId = SaveGame->CheckpointId;
+		Writer << CheckpointId;
+	}
+
+	// One chunk per module
+	for (const TPair<FString, UModularSaveData*>& Pair : SaveGame->SaveModules)
+	{
+		if (!IsValid(Pair.Value) || Pair.Value == SkipModule)
+		{
+			continue;
+		}
+
+		FSaveContainerChunkPayload& Chunk = OutChunks.AddDefaulted_GetRef();
+		Chunk.Name = Pair.Key;
+		Chunk.ClassPath = Pair.Value->GetClass()->GetPathName();
+		SaveContainerPrivate::SerializeModule(Pair.Value, Chunk.Bytes);
+	}
+}
+
+void FSaveContainer::Assemble(const TArray<FSaveContainerChunkPayload>& Chunks, TArray<uint8>& OutBytes, FName CompressionFormat)
+{
+	TArray<FSaveContainerChunkEntry> Entries;
+	TArray<TArray<uint8>> StoredChunks;
+	Entries.SetNum(Chunks.Num());
+	StoredChunks.SetNum(Chunks.Num());
+
+	// Chunks are independent - compress them side by side
+	ParallelFor(Chunks.Num(), [&](int32 Index)
+	{
+		SaveContainerPrivate::CompressChunk(Chunks[Index], CompressionFormat, Entries[Index], StoredChunks[Index]);
+	});
+
+	int64 DataSize = 0;
+	for (FSaveContainerChunkEntry& Entry : Entries)
+	{
+		Entry.Offset = DataSize;
+		DataSize += Entry.StoredSize;
+	}
+
+	TArray<uint8> TocBytes;
+	{
+		FMemoryWriter TocWriter(TocBytes, true);
+		for (FSaveContainerChunkEntry& Entry : Entries)
+		{
+			TocWriter << Entry;
+		}
+	}
+
+	FSaveContainerHeader Header;
+	Header.NumChunks = Entries.Num();
+	Header.TocSize = TocBytes.Num();
+	Header.TocCrc = FCrc::MemCrc32(TocBytes.GetData(), TocBytes.Num());
+
+	OutBytes.Reset(static_cast<int32>(Header.GetDataOffset() + DataSize));
+	FMemoryWriter Writer(OutBytes, true);
+	Writer << Header;
+	Writer.Serialize(TocBytes.GetData(), TocBytes.Num());
+	for (TArray<uint8>& Stored : StoredChunks)
+	{
+		Writer.Serialize(Stored.GetData(), Stored.Num());
+	}
+}
+
+void FSaveContainer::Write(const UMasterSaveGame* SaveGame, TArray<uint8>& OutBytes)
+{
+	TArray<FSaveContainerChunkPayload> Chunks;
+	SerializeChunks(SaveGame, Chunks);
+	Assemble(Chunks, OutBytes);
+}
+
+// ============================================================================
+// READING
+// ============================================================================
+
+bool FSaveContainer::IsContainer(TConstArrayView<uint8> Bytes)
+{
+	if (Bytes.Num() < FSaveContainerHeader::SerializedSize)
+	{
+		return false;
+	}
+
+	uint32 Magic = 0;
+	FMemory::Memcpy(&Magic, Bytes.GetData(), sizeof(Magic));
+	return Magic == FSaveContainerHeader::MagicNumber;
+}
+
+bool FSaveContainer::ReadTableOfContents(TConstArrayView<uint8> Bytes, FSaveContainerHeader& OutHeader,
+	TArray<FSaveContainerChunkEntry>& OutEntries)
+{
+	OutEntries.Reset();
+
+	if (!IsContainer(Bytes))
+	{
+		return false;
+	}
+
+	FMemoryReaderView HeaderReader(Bytes, true);
+	HeaderReader << OutHeader;
+	if (HeaderReader.IsError() || !OutHeader.IsValid() || OutHeader.GetDataOffset() > Bytes.Num())
+	{
+		return false;
+	}
+
+	// Verify before parsing so a damaged table can't drive string/array allocations
+	TConstArrayView<uint8> TocBytes = Bytes.Slice(FSaveContainerHeader::SerializedSize, OutHeader.TocSize);
+	if (FCrc::MemCrc32(TocBytes.GetData(), TocBytes.Num()) != OutHeader.TocCrc)
+	{
+		return false;
+	}
+
+	// NumChunks sits in the header, outside TocCrc - bound it by what the table could actually hold
+	if (OutHeader.NumChunks > OutHeader.TocSize / FSaveContainerChunkEntry::MinSerializedSize)
+	{
+		return false;
+	}
+
+	FMemoryReaderView TocReader(TocBytes, true);
+	OutEntries.Reserve(OutHeader.NumChunks);
+	for (int32 Index = 0; Index < OutHeader.NumChunks; ++Index)
+	{
+		TocReader << OutEntries.AddDefaulted_GetRef();
+		if (TocReader.IsError())
+		{
+			OutEntries.Reset();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FSaveContainer::ReadChunk(TConstArrayView<uint8> Bytes, const FSaveContainerHeader& Header,
+	const FSaveContainerChunkEntry& Entry, TArray<uint8>& OutBytes)
+{
+	OutBytes.Reset();
+
+	const int64 Start = Header.GetDataOffset() + Entry.Offset;
+	if (Entry.Offset < 0 || Entry.StoredSize < 0 || Entry.UncompressedSize < 0 || Start + Entry.StoredSize > Bytes.Num())
+	{
+		return false;
+	}
+
+	const uint8* Stored = Bytes.GetData() + Start;
+	if (FCrc::MemCrc32(Stored, Entry.StoredSize) != Entry.StoredCrc)
+	{
+		return false;
+	}
+
+	if (Entry.CompressionFormat.IsNone())
+	{
+		if (Entry.StoredSize != Entry.UncompressedSize)
+		{
+			return false;
+		}
+		OutBytes.Append(Stored, Entry.StoredSize);
+	}
+	else
+	{
+		OutBytes.SetNumUninitialized(Entry.UncompressedSize);
+		if (!FCompression::UncompressMemory(Entry.CompressionFormat, OutBytes.GetData(), Entry.UncompressedSize, Stored, Entry.StoredSize))
+		{
+			OutBytes.Reset();
+			return false;
+		}
+	}
+
+	if (FCrc::MemCrc32(OutBytes.GetData(), OutBytes.Num()) != Entry.UncompressedCrc)
+	{
+		OutBytes.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+UMasterSaveGame* FSaveContainer::Read(TConstArrayView<uint8> Bytes, TArray<FString>* OutCorruptChunks)
+{
+	FSaveContainerHeader Header;
+	TArray<FSaveContainerChunkEntry> Entries;
+	if (!ReadTableOfContents(Bytes, Header, Entries))
+	{
+		UE_LOG(LogTemp, Error, TEXT("FSaveContainer::Read - Header or table of contents is corrupt"));
+		return nullptr;
+	}
+
+	UMasterSaveGame* SaveGame = NewObject<UMasterSaveGame>(GetTransientPackage());
+	bool bHasSaveInfo = false;
+
+	TArray<uint8> ChunkBytes;
+	for (const FSaveContainerChunkEntry& Entry : Entries)
+	{
+		if (!ReadChunk(Bytes, Header, Entry, ChunkBytes))
+		{
+			UE_LOG(LogTemp, Error, TEXT("FSaveContainer::Read - Chunk '%s' is corrupt, skipping"), *Entry.Name);
+			if (OutCorruptChunks)
+			{
+				OutCorruptChunks->Add(Entry.Name);
+			}
+			continue;
+		}
+
+		if (!ApplyChunk(SaveGame, Entry.Name, Entry.ClassPath, ChunkBytes))
+		{
+			if (OutCorruptChunks)
+			{
+				OutCorruptChunks->Add(Entry.Name);
+			}
+			continue;
+		}
+
+		bHasSaveInfo |= (Entry.Name == MasterChunkName);
+	}
+
+	if (!bHasSaveInfo)
+	{
+		UE_LOG(LogTemp, Error, TEXT("FSaveContainer::Read - Master chunk missing or corrupt"));
+		return nullptr;
+	}
+
+	return SaveGame;
+}
+
+bool FSaveContainer::ApplyChunk(UMasterSaveGame* SaveGame, const FString& Name, const FString& ClassPath, const TArray<uint8>& ChunkBytes)
+{
+	if (Name == MasterChunkName)
+	{
+		FSaveContainerSaveInfo Info;
+		FMemoryReader Reader(ChunkBytes, true);
+		Reader << Info;
+		if (Reader.IsError())
+		{
+			return false;
+		}
+
+		SaveGame->SaveSlotName = Info.SaveSlotName;
+		SaveGame->SaveTimestamp = Info.SaveTimestamp;
+		SaveGame->MasterSaveVersion = Info.MasterSaveVersion;
+		SaveGame->SaveDescription = Info.SaveDescription;
+		SaveGame->LevelName = Info.LevelName;
+		SaveGame->PlayTimeSeconds = Info.PlayTimeSeconds;
+		return true;
+	}
+
+	if (Name == SubsystemRecordsChunkName)
+	{
+		FMemoryReader Reader(ChunkBytes, true);
+		FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+		SaveContainerPrivate::SerializeSubsystemRecords(Ar, SaveGame->SubsystemSaveRecords);
+		return !Ar.IsError();
+	}
+
+	if (Name == CheckpointChunkName)
+	{
+		FMemoryReader Reader(ChunkBytes, true);
+		Reader << SaveGame->CheckpointId;
+		return !Reader.IsError();
+	}
+
+	UClass* ModuleClass = FSoftClassPath(ClassPath).TryLoadClass<UModularSaveData>();
+	if (!ModuleClass)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FSaveContainer::ApplyChunk - Module class '%s' not found, skipping '%s'"), *ClassPath, *Name);
+		return false;
+	}
+
+	UModularSaveData* Module = NewObject<UModularSaveData>(SaveGame, ModuleClass);
+	if (!SaveContainerPrivate::DeserializeModule(Module, ChunkBytes))
+	{
+		UE_LOG(LogTemp, Error, TEXT("FSaveContainer::ApplyChunk - Module '%s' failed to deserialize, skipping"), *Name);
+		return false;
+	}
+
+	// Direct add - AddOrUpdateModule would stamp a new LastModified
+	SaveGame->SaveModules.Add(Name, Module);
+	return true;
+}
+
+UModularSaveData* FSaveContainer::ReadModule(TConstArrayView<uint8> Bytes, TSubclassOf<UModularSaveData> ModuleClass, UObject* Outer)
+{
+	if (!ModuleClass)
+	{
+		return nullptr;
+	}
+
+	FSaveContainerHeader Header;
+	TArray<FSaveContainerChunkEntry> Entries;
+	if (!ReadTableOfContents(Bytes, Header, Entries))
+	{
+		return nullptr;
+	}
+
+	const FSaveContainerChunkEntry* Entry = SaveContainerPrivate::FindEntry(Entries, ModuleClass->GetName());
+	TArray<uint8> ChunkBytes;
+	if (!Entry || !ReadChunk(Bytes, Header, *Entry, ChunkBytes))
+	{
+		return nullptr;
+	}
+
+	UModularSaveData* Module = NewObject<UModularSaveData>(Outer ? Outer : GetTransientPackage(), ModuleClass);
+	return SaveContainerPrivate::DeserializeModule(Module, ChunkBytes) ? Module : nullptr;
+}
+
+bool FSaveContainer::ReadSaveInfo(TConstArrayView<uint8> Bytes, FSaveContainerSaveInfo& OutInfo)
+{
+	FSaveContainerHeader Header;
+	TArray<FSaveContainerChunkEntry> Entries;
+	if (!ReadTableOfContents(Bytes, Header, Entries))
+	{
+		return false;
+	}
+
+	const FSaveContainerChunkEntry* Entry = SaveContainerPrivate::FindEntry(Entries, MasterChunkName);
+	TArray<uint8> ChunkBytes;
+	if (!Entry || !ReadChunk(Bytes, Header, *Entry, ChunkBytes))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(ChunkBytes, true);
+	Reader << OutInfo;
+	return !Reader.IsError();
+}
+
+bool FSaveContainer::Validate(TConstArrayView<uint8> Bytes, TArray<FString>& OutCorruptChunks)
+{
+	OutCorruptChunks.Reset();
+
+	FSaveContainerHeader Header;
+	TArray<FSaveContainerChunkEntry> Entries;
+	if (!ReadTableOfContents(Bytes, Header, Entries))
+	{
+		OutCorruptChunks.Add(TEXT("$TableOfContents"));
+		return false;
+	}
+
+	TArray<uint8> ChunkBytes;
+	for (const FSaveContainerChunkEntry& Entry : Entries)
+	{
+		if (!ReadChunk(Bytes, Header, Entry, ChunkBytes))
+		{
+			OutCorruptChunks.Add(Entry.Name);
+		}
+	}
+
+	return OutCorruptChunks.Num() == 0;
+}
+
+// ============================================================================
+// ROUND-TRIP / SIZE / TIME BENCHMARK (development builds only)
+// ============================================================================
+
+#if !UE_BUILD_SHIPPING
+
+namespace SaveContainerBenchmark
+{
+	/** Save game with every standard module and NumActors world-state envelopes spread over a few levels */
+	static UMasterSaveGame* MakeSampleSave(int32 NumActors)
+	{
+		UMasterSaveGame* SaveGame = Cast<UMasterSaveGame>(UGameplayStatics::CreateSaveGameObject(UMasterSaveGame::StaticClass()));
+		SaveGame->SaveSlotName = TEXT("BenchmarkSlot");
+		SaveGame->SaveDescription = TEXT("Save container benchmark");
+		SaveGame->LevelName = TEXT("Benchmark_Level_0");
+		SaveGame->PlayTimeSeconds = 3600.f;
+
+		SaveGame->CreateAndAddModule(UInventorySaveModule::StaticClass());
+		SaveGame->CreateAndAddModule(UAbilitiesSaveModule::StaticClass());
+		SaveGame->CreateAndAddModule(UCharacterSaveModule::StaticClass());
+		SaveGame->CreateAndAddModule(UUserSettingsSaveModule::StaticClass());
+		UWorldStateSaveModule* WorldModule = Cast<UWorldStateSaveModule>(SaveGame->CreateAndAddModule(UWorldStateSaveModule::StaticClass()));
+
+		for (int32 i = 0; i < NumActors; ++i)
+		{
+			FActorSaveEnvelope Envelope;
+			Envelope.LevelName = FString::Printf(TEXT("Benchmark_Level_%d"), i % 4);
+			Envelope.ActorSaveID = FString::Printf(TEXT("/Game/Maps/%s.%s:PersistentLevel.BP_Container_C_%d"), *Envelope.LevelName, *Envelope.LevelName, i);
+			Envelope.ActorClass = FSoftClassPath(TEXT("/Game/Blueprints/BP_Container.BP_Container_C"));
+			Envelope.ActorTransform = FTransform(FVector(i * 100.0, (i % 17) * 50.0, 0.0));
+			Envelope.bIsDestroyed = (i % 25) == 0;
+
+			// Representative payload: mostly structured fields with some variation
+			Envelope.ActorBinaryData.SetNumUninitialized(96);
+			for (int32 b = 0; b < Envelope.ActorBinaryData.Num(); ++b)
+			{
+				Envelope.ActorBinaryData[b] = static_cast<uint8>((b % 8 == 0) ? (i + b) & 0xFF : b);
+			}
+
+			FComponentSaveRecord& Component = Envelope.ComponentRecords.Add(TEXT("Durability"));
+			Component.ComponentSaveID = TEXT("Durability");
+			Component.ComponentClass = FName(TEXT("DurabilityComponent"));
+			Component.BinaryData.Init(static_cast<uint8>(i & 0xFF), 16);
+
+			WorldModule->SaveActorState(Envelope);
+		}
+
+		return SaveGame;
+	}
+
+	static void Run(const TArray<FString>& Args)
+	{
+		const int32 NumActors = Args.Num() > 0 ? FMath::Max(0, FCString::Atoi(*Args[0])) : 2000;
+		const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 10;
+
+		UMasterSaveGame* SaveGame = MakeSampleSave(NumActors);
+		const int32 NumModules = SaveGame->GetModuleCount();
+
+		// Legacy: whole object through UGameplayStatics
+		TArray<uint8> LegacyBytes;
+		USaveGame* LegacyLoaded = nullptr;
+		double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			UGameplayStatics::SaveGameToMemory(SaveGame, LegacyBytes);
+		}
+		const double LegacySaveMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			LegacyLoaded = UGameplayStatics::LoadGameFromMemory(LegacyBytes);
+		}
+		const double LegacyLoadMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+		int32 LegacyModules = 0;
+		if (const UMasterSaveGame* LegacyMaster = Cast<UMasterSaveGame>(LegacyLoaded))
+		{
+			for (const TPair<FString, UModularSaveData*>& Pair : LegacyMaster->SaveModules)
+			{
+				LegacyModules += Pair.Value ? 1 : 0;
+			}
+		}
+
+		// Container
+		TArray<uint8> ContainerBytes;
+		UMasterSaveGame* ContainerLoaded = nullptr;
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			FSaveContainer::Write(SaveGame, ContainerBytes);
+		}
+		const double ContainerSaveMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			ContainerLoaded = FSaveContainer::Read(ContainerBytes);
+		}
+		const double ContainerLoadMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			FSaveContainer::ReadModule(ContainerBytes, UCharacterSaveModule::StaticClass(), nullptr);
+		}
+		const double SingleModuleMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+		Start = FPlatformTime::Seconds();
+		TArray<FString> CorruptChunks;
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			FSaveContainer::Validate(ContainerBytes, CorruptChunks);
+		}
+		const double ValidateMs = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+
+		// Round trip: re-writing what was read must reproduce the file byte for byte
+		TArray<uint8> RewrittenBytes;
+		FSaveContainer::Write(ContainerLoaded, RewrittenBytes);
+		const bool bRoundTrip = ContainerLoaded && ContainerLoaded->GetModuleCount() == NumModules && RewrittenBytes == ContainerBytes;
+
+		// Corruption: flipping one byte inside a chunk must flag exactly that chunk
+		FSaveContainerHeader Header;
+		TArray<FSaveContainerChunkEntry> Entries;
+		FSaveContainer::ReadTableOfContents(ContainerBytes, Header, Entries);
+
+		int32 DetectedCount = 0;
+		int32 TestedCount = 0;
+		for (const FSaveContainerChunkEntry& Entry : Entries)
+		{
+			if (Entry.StoredSize == 0)
+			{
+				continue;
+			}
+
+			TArray<uint8> Damaged = ContainerBytes;
+			Damaged[Header.GetDataOffset() + Entry.Offset + Entry.StoredSize / 2] ^= 0x5A;
+
+			TestedCount++;
+			if (!FSaveContainer::Validate(Damaged, CorruptChunks) && CorruptChunks.Num() == 1 && CorruptChunks[0] == Entry.Name)
+			{
+				DetectedCount++;
+			}
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("=== Save Container Benchmark (%d actors, %d modules, %d iterations) ==="), NumActors, NumModules, Iterations);
+		UE_LOG(LogTemp, Warning, TEXT("%-22s %12s %10s %10s %10s"), TEXT("Path"), TEXT("Bytes"), TEXT("Save ms"), TEXT("Load ms"), TEXT("Modules"));
+		UE_LOG(LogTemp, Warning, TEXT("%-22s %12d %10.3f %10.3f %7d/%d"), TEXT("UGameplayStatics"),
+			LegacyBytes.Num(), LegacySaveMs, LegacyLoadMs, LegacyModules, NumModules);
+		UE_LOG(LogTemp, Warning, TEXT("%-22s %12d %10.3f %10.3f %7d/%d"), TEXT("Chunked container"),
+			ContainerBytes.Num(), ContainerSaveMs, ContainerLoadMs, ContainerLoaded ? ContainerLoaded->GetModuleCount() : 0, NumModules);
+
+		for (const FSaveContainerChunkEntry& Entry : Entries)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("  chunk %-26s %10d -> %10d bytes (%s)"), *Entry.Name,
+				Entry.UncompressedSize, Entry.StoredSize, Entry.CompressionFormat.IsNone() ? TEXT("stored") : *Entry.CompressionFormat.ToString());
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("Single module read (Character): %.3f ms, full validate: %.3f ms"), SingleModuleMs, ValidateMs);
+		UE_LOG(LogTemp, Warning, TEXT("Round trip: %s"), bRoundTrip ? TEXT("PASS") : TEXT("FAIL"));
+		UE_LOG(LogTemp, Warning, TEXT("Corruption detection: %d/%d chunks flagged correctly"), DetectedCount, TestedCount);
+		UE_LOG(LogTemp, Warning, TEXT("=========================="));
+	}
+}
+
+static FAutoConsoleCommand GBenchmarkSaveContainerCmd(
+	TEXT("BenchmarkSaveContainer"),
+	TEXT("Round-trip, corruption and size/time comparison of the chunked save container vs UGameplayStatics. Usage: BenchmarkSaveContainer [NumActors=2000] [Iterations=10]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&SaveContainerBenchmark::Run)
+);
+
+#endif // !UE_BUILD_SHIPPING
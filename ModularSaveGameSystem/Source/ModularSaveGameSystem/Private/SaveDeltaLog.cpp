@@ -0,0 +1,298 @@
+// Copyright Windwalker Productions. All Rights Reserved.
+
+#include "SaveDeltaLog.h"
+#include "MasterSaveGame.h"
+#include "WorldStateSaveModule.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+namespace SaveDeltaLogPrivate
+{
+	static constexpr uint32 LogMagic = 0x4C445757; // "WWDL"
+	static constexpr uint32 BatchMagic = 0x48435442; // "BTCH"
+	static constexpr uint16 CurrentVersion = 1;
+
+	struct FLogHeader
+	{
+		static constexpr int32 SerializedSize = 4 + 2 + 2 + 16;
+
+		uint32 Magic = LogMagic;
+		uint16 Version = CurrentVersion;
+		uint16 Flags = 0;
+		FGuid CheckpointId;
+
+		bool IsValid() const { return Magic == LogMagic && Version <= CurrentVersion; }
+
+		friend FArchive& operator<<(FArchive& Ar, FLogHeader& Header)
+		{
+			Ar << Header.Magic;
+			Ar << Header.Version;
+			Ar << Header.Flags;
+			Ar << Header.CheckpointId;
+			return Ar;
+		}
+	};
+
+	/** Batch frame: magic, payload size, payload CRC */
+	static constexpr int32 BatchFrameSize = 4 + 4 + 4;
+
+	/** Same user as the base saves (UMasterSaveSubsystem::USER_INDEX) */
+	static constexpr int32 LogUserIndex = 0;
+
+	static bool LoadLog(const FString& SlotName, TArray<uint8>& OutBytes)
+	{
+		ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+		const FString LogSlotName = FSaveDeltaLog::GetLogSlotName(SlotName);
+		return SaveSystem
+			&& SaveSystem->DoesSaveGameExist(*LogSlotName, LogUserIndex)
+			&& SaveSystem->LoadGame(false, *LogSlotName, LogUserIndex, OutBytes);
+	}
+
+	static bool ReadHeader(const TArray<uint8>& Bytes, FLogHeader& OutHeader)
+	{
+		if (Bytes.Num() < FLogHeader::SerializedSize)
+		{
+			return false;
+		}
+
+		FMemoryReader Reader(Bytes, true);
+		Reader << OutHeader;
+		return !Reader.IsError() && OutHeader.IsValid();
+	}
+
+	/**
+	 * Walk the batches after the header, calling Visit(PayloadStart, PayloadSize) for each intact one
+	 * @return Offset just past the last intact batch - everything after it is a torn or corrupt tail
+	 */
+	template<typename VisitorType>
+	static int64 ForEachIntactBatch(const FString& SlotName, const TArray<uint8>& Bytes, VisitorType&& Visit)
+	{
+		int64 Offset = FLogHeader::SerializedSize;
+		while (Offset + BatchFrameSize <= Bytes.Num())
+		{
+			FMemoryReader Frame(Bytes, true);
+			Frame.Seek(Offset);
+
+			uint32 Magic = 0;
+			int32 PayloadSize = 0;
+			uint32 PayloadCrc = 0;
+			Frame << Magic;
+			Frame << PayloadSize;
+			Frame << PayloadCrc;
+
+			const int64 PayloadStart = Offset + BatchFrameSize;
+			if (Magic != BatchMagic || PayloadSize < 0 || PayloadStart + PayloadSize > Bytes.Num()
+				|| FCrc::MemCrc32(Bytes.GetData() + PayloadStart, PayloadSize) != PayloadCrc)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("FSaveDeltaLog - '%s' has a torn or corrupt batch at offset %lld, dropping the rest"),
+					*SlotName, Offset);
+				break;
+			}
+
+			Visit(PayloadStart, PayloadSize);
+			Offset = PayloadStart + PayloadSize;
+		}
+		return FMath::Min<int64>(Offset, Bytes.Num());
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FSaveDeltaRecord& Record)
+{
+	uint8 Type = static_cast<uint8>(Record.Type);
+	Ar << Type;
+	Ar << Record.Chunk.Name;
+	Ar << Record.Chunk.ClassPath;
+	Ar << Record.Chunk.Bytes;
+
+	if (Ar.IsLoading())
+	{
+		Record.Type = static_cast<ESaveDeltaRecordType>(Type);
+	}
+	return Ar;
+}
+
+FString FSaveDeltaLog::GetLogSlotName(const FString& SlotName)
+{
+	return SlotName + TEXT("_delta");
+}
+
+bool FSaveDeltaLog::AppendBatch(const FString& SlotName, const FGuid& CheckpointId, const TArray<FSaveDeltaRecord>& Records, int64* OutLogBytes)
+{
+	using namespace SaveDeltaLogPrivate;
+
+	if (Records.Num() == 0)
+	{
+		return true;
+	}
+
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	if (!SaveSystem)
+	{
+		return false;
+	}
+
+	// A log for an older checkpoint is stale - start over rather than append to it.
+	// Appending after a torn batch would make every later batch unreadable, so cut back to the last intact one.
+	TArray<uint8> Bytes;
+	FLogHeader ExistingHeader;
+	if (LoadLog(SlotName, Bytes) && ReadHeader(Bytes, ExistingHeader) && ExistingHeader.CheckpointId == CheckpointId)
+	{
+		const int64 IntactBytes = ForEachIntactBatch(SlotName, Bytes, [](int64, int32) {});
+		Bytes.SetNum(IntactBytes, EAllowShrinking::No);
+	}
+	else
+	{
+		Bytes.Reset();
+		FMemoryWriter HeaderWriter(Bytes, true);
+		FLogHeader Header;
+		Header.CheckpointId = CheckpointId;
+		HeaderWriter << Header;
+	}
+
+	TArray<uint8> Payload;
+	{
+		FMemoryWriter PayloadWriter(Payload, true);
+		int32 NumRecords = Records.Num();
+		PayloadWriter << NumRecords;
+		for (const FSaveDeltaRecord& Record : Records)
+		{
+			PayloadWriter << const_cast<FSaveDeltaRecord&>(Record);
+		}
+	}
+
+	{
+		FMemoryWriter Writer(Bytes, true, true);
+		uint32 Magic = BatchMagic;
+		int32 PayloadSize = Payload.Num();
+		uint32 PayloadCrc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+		Writer << Magic;
+		Writer << PayloadSize;
+		Writer << PayloadCrc;
+		Writer.Serialize(Payload.GetData(), Payload.Num());
+	}
+
+	if (!SaveSystem->SaveGame(false, *GetLogSlotName(SlotName), LogUserIndex, Bytes))
+	{
+		return false;
+	}
+
+	if (OutLogBytes)
+	{
+		*OutLogBytes = Bytes.Num();
+	}
+	return true;
+}
+
+bool FSaveDeltaLog::ReadRecords(const FString& SlotName, const FGuid& CheckpointId, TArray<FSaveDeltaRecord>& OutRecords, int64* OutLogBytes)
+{
+	using namespace SaveDeltaLogPrivate;
+
+	OutRecords.Reset();
+
+	TArray<uint8> Bytes;
+	FLogHeader Header;
+	if (!LoadLog(SlotName, Bytes) || !ReadHeader(Bytes, Header))
+	{
+		return false;
+	}
+
+	if (Header.CheckpointId != CheckpointId)
+	{
+		UE_LOG(LogTemp, Log, TEXT("FSaveDeltaLog::ReadRecords - '%s' log belongs to another checkpoint, ignoring"), *SlotName);
+		return false;
+	}
+
+	const int64 IntactBytes = ForEachIntactBatch(SlotName, Bytes, [&Bytes, &OutRecords](int64 PayloadStart, int32 PayloadSize)
+	{
+		FMemoryReader Reader(Bytes, true);
+		Reader.Seek(PayloadStart);
+
+		int32 NumRecords = 0;
+		Reader << NumRecords;
+		for (int32 i = 0; i < NumRecords; ++i)
+		{
+			FSaveDeltaRecord Record;
+			Reader << Record;
+			if (Reader.IsError())
+			{
+				break;
+			}
+			OutRecords.Add(MoveTemp(Record));
+		}
+	});
+
+	if (OutLogBytes)
+	{
+		*OutLogBytes = IntactBytes;
+	}
+	return true;
+}
+
+void FSaveDeltaLog::Apply(UMasterSaveGame* SaveGame, const TArray<FSaveDeltaRecord>& Records)
+{
+	if (!SaveGame)
+	{
+		return;
+	}
+
+	for (const FSaveDeltaRecord& Record : Records)
+	{
+		if (Record.Type == ESaveDeltaRecordType::ActorEnvelopes)
+		{
+			UWorldStateSaveModule* WorldModule = SaveGame->GetModule<UWorldStateSaveModule>();
+			if (!WorldModule)
+			{
+				WorldModule = Cast<UWorldStateSaveModule>(SaveGame->CreateAndAddModule(UWorldStateSaveModule::StaticClass()));
+			}
+
+			TArray<FActorSaveEnvelope> Envelopes;
+			FMemoryReader Reader(Record.Chunk.Bytes, true);
+			FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+			SerializeEnvelopes(Ar, Envelopes);
+			WorldModule->AdoptActorStates(MoveTemp(Envelopes));
+		}
+		else
+		{
+			FSaveContainer::ApplyChunk(SaveGame, Record.Chunk.Name, Record.Chunk.ClassPath, Record.Chunk.Bytes);
+		}
+	}
+}
+
+bool FSaveDeltaLog::Delete(const FString& SlotName)
+{
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	if (!SaveSystem)
+	{
+		return false;
+	}
+
+	const FString LogSlotName = GetLogSlotName(SlotName);
+	return !SaveSystem->DoesSaveGameExist(*LogSlotName, SaveDeltaLogPrivate::LogUserIndex)
+		|| SaveSystem->DeleteGame(false, *LogSlotName, SaveDeltaLogPrivate::LogUserIndex);
+}
+
+void FSaveDeltaLog::SerializeEnvelopes(FArchive& Ar, TArray<FActorSaveEnvelope>& Envelopes)
+{
+	int32 NumEnvelopes = Envelopes.Num();
+	Ar << NumEnvelopes;
+
+	if (Ar.IsLoading())
+	{
+		Envelopes.Reset(NumEnvelopes);
+		for (int32 i = 0; i < NumEnvelopes && !Ar.IsError(); ++i)
+		{
+			FActorSaveEnvelope::StaticStruct()->SerializeBin(Ar, &Envelopes.AddDefaulted_GetRef());
+		}
+	}
+	else
+	{
+		for (FActorSaveEnvelope& Envelope : Envelopes)
+		{
+			FActorSaveEnvelope::StaticStruct()->SerializeBin(Ar, &Envelope);
+		}
+	}
+}
@@ -0,0 +1,310 @@
+// Copyright Windwalker Productions. All Rights Reserved.
+
+#include "SaveSlotMetadata.h"
+#include "MasterSaveGame.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace SaveMetadataSidecarPrivate
+{
+	static constexpr uint32 Magic = 0x444D5757; // "WWMD"
+	static constexpr uint16 CurrentVersion = 1;
+
+	static constexpr int32 SlotNameBytes = 64;
+	static constexpr int32 LevelNameBytes = 128;
+	static constexpr int32 DescriptionBytes = 284;
+	static constexpr int32 FixedFieldsBytes = 4 + 2 + 2 + 8 + 4 + 4 + 8;
+	static constexpr int32 CrcOffset = FSaveMetadataSidecar::SerializedSize - sizeof(uint32);
+
+	static_assert(FixedFieldsBytes + SlotNameBytes + LevelNameBytes + DescriptionBytes == CrcOffset,
+		"Sidecar fields must fill the fixed layout exactly");
+
+	static const TCHAR* SidecarSuffix = TEXT("_meta");
+
+	/** Slot holding the catalogue: magic, version, flags, payload CRC, then the slot names */
+	static const TCHAR* CatalogueSlotName = TEXT("_SaveSlotCatalogue");
+	static constexpr uint32 CatalogueMagic = 0x43535757; // "WWSC"
+	static constexpr int32 CatalogueHeaderSize = 4 + 2 + 2 + 4;
+
+	/** Same user as the base saves (UMasterSaveSubsystem::USER_INDEX) */
+	static constexpr int32 MetaUserIndex = 0;
+
+	/** Catalogue read-modify-write runs on the game thread and on background save tasks */
+	static FCriticalSection CatalogueLock;
+
+	static bool LoadSlot(const FString& SlotName, TArray<uint8>& OutBytes)
+	{
+		ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+		return SaveSystem
+			&& SaveSystem->DoesSaveGameExist(*SlotName, MetaUserIndex)
+			&& SaveSystem->LoadGame(false, *SlotName, MetaUserIndex, OutBytes);
+	}
+
+	static bool ReadCatalogue(TArray<FString>& OutSlotNames)
+	{
+		OutSlotNames.Reset();
+
+		TArray<uint8> Bytes;
+		if (!LoadSlot(CatalogueSlotName, Bytes) || Bytes.Num() < CatalogueHeaderSize)
+		{
+			return false;
+		}
+
+		FMemoryReader Reader(Bytes, true);
+		uint32 MagicValue = 0;
+		uint16 Version = 0;
+		uint16 Flags = 0;
+		uint32 PayloadCrc = 0;
+		Reader << MagicValue << Version << Flags << PayloadCrc;
+
+		// Verify before parsing so a damaged catalogue can't drive string/array allocations
+		if (MagicValue != CatalogueMagic || Version > CurrentVersion
+			|| FCrc::MemCrc32(Bytes.GetData() + CatalogueHeaderSize, Bytes.Num() - CatalogueHeaderSize) != PayloadCrc)
+		{
+			return false;
+		}
+
+		Reader << OutSlotNames;
+		if (Reader.IsError())
+		{
+			OutSlotNames.Reset();
+			return false;
+		}
+		return true;
+	}
+
+	static bool WriteCatalogue(const TArray<FString>& SlotNames)
+	{
+		ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+		if (!SaveSystem)
+		{
+			return false;
+		}
+
+		TArray<uint8> Payload;
+		FMemoryWriter PayloadWriter(Payload, true);
+		TArray<FString> Names = SlotNames;
+		PayloadWriter << Names;
+
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes, true);
+		uint32 MagicValue = CatalogueMagic;
+		uint16 Version = CurrentVersion;
+		uint16 Flags = 0;
+		uint32 PayloadCrc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+		Writer << MagicValue << Version << Flags << PayloadCrc;
+		Writer.Serialize(Payload.GetData(), Payload.Num());
+
+		return SaveSystem->SaveGame(false, CatalogueSlotName, MetaUserIndex, Bytes);
+	}
+
+	/** @param bAdd - add the slot if missing, otherwise remove it; rewrites only on change */
+	static bool UpdateCatalogue(const FString& SlotName, bool bAdd)
+	{
+		FScopeLock Lock(&CatalogueLock);
+
+		TArray<FString> SlotNames;
+		ReadCatalogue(SlotNames);
+
+		const bool bListed = SlotNames.Contains(SlotName);
+		if (bListed == bAdd)
+		{
+			return true;
+		}
+
+		if (bAdd)
+		{
+			SlotNames.Add(SlotName);
+		}
+		else
+		{
+			SlotNames.Remove(SlotName);
+		}
+		return WriteCatalogue(SlotNames);
+	}
+
+	/** UTF-8 into a zero-padded fixed field, cut on a character boundary */
+	static void WriteFixedString(FArchive& Ar, const FString& Value, int32 FieldBytes)
+	{
+		FTCHARToUTF8 Utf8(*Value);
+		int32 Length = FMath::Min(Utf8.Length(), FieldBytes - 1);
+		while (Length > 0 && Length < Utf8.Length() && (static_cast<uint8>(Utf8.Get()[Length]) & 0xC0) == 0x80)
+		{
+			--Length;
+		}
+
+		TArray<uint8, TInlineAllocator<512>> Field;
+		Field.SetNumZeroed(FieldBytes);
+		FMemory::Memcpy(Field.GetData(), Utf8.Get(), Length);
+		Ar.Serialize(Field.GetData(), FieldBytes);
+	}
+
+	static FString ReadFixedString(FArchive& Ar, int32 FieldBytes)
+	{
+		TArray<ANSICHAR, TInlineAllocator<512>> Field;
+		Field.SetNumZeroed(FieldBytes + 1);
+		Ar.Serialize(Field.GetData(), FieldBytes);
+
+		const int32 Length = FCStringAnsi::Strlen(Field.GetData());
+		FUTF8ToTCHAR Converted(Field.GetData(), Length);
+		return FString(Converted.Length(), Converted.Get());
+	}
+}
+
+FString FSaveMetadataSidecar::GetSidecarSlotName(const FString& SlotName)
+{
+	return SlotName + SaveMetadataSidecarPrivate::SidecarSuffix;
+}
+
+FSaveSlotMetadata FSaveMetadataSidecar::FromSaveGame(const UMasterSaveGame* SaveGame, int64 SaveSizeBytes)
+{
+	FSaveSlotMetadata Metadata;
+	if (SaveGame)
+	{
+		Metadata.SaveSlotName = SaveGame->SaveSlotName;
+		Metadata.SaveTimestamp = SaveGame->SaveTimestamp;
+		Metadata.MasterSaveVersion = SaveGame->MasterSaveVersion;
+		Metadata.SaveDescription = SaveGame->SaveDescription;
+		Metadata.LevelName = SaveGame->LevelName;
+		Metadata.PlayTimeSeconds = SaveGame->PlayTimeSeconds;
+	}
+	Metadata.SaveSizeBytes = SaveSizeBytes;
+	return Metadata;
+}
+
+void FSaveMetadataSidecar::Encode(const FSaveSlotMetadata& Metadata, TArray<uint8>& OutBytes)
+{
+	using namespace SaveMetadataSidecarPrivate;
+
+	OutBytes.Reset(SerializedSize);
+	FMemoryWriter Writer(OutBytes, true);
+
+	uint32 MagicValue = Magic;
+	uint16 Version = CurrentVersion;
+	uint16 Flags = 0;
+	int64 Ticks = Metadata.SaveTimestamp.GetTicks();
+	float PlayTime = Metadata.PlayTimeSeconds;
+	int32 SaveVersion = Metadata.MasterSaveVersion;
+	int64 SaveSize = Metadata.SaveSizeBytes;
+
+	Writer << MagicValue << Version << Flags << Ticks << PlayTime << SaveVersion << SaveSize;
+	WriteFixedString(Writer, Metadata.SaveSlotName, SlotNameBytes);
+	WriteFixedString(Writer, Metadata.LevelName, LevelNameBytes);
+	WriteFixedString(Writer, Metadata.SaveDescription, DescriptionBytes);
+
+	uint32 Crc = FCrc::MemCrc32(OutBytes.GetData(), OutBytes.Num());
+	Writer << Crc;
+
+	check(OutBytes.Num() == SerializedSize);
+}
+
+bool FSaveMetadataSidecar::Decode(TConstArrayView<uint8> Bytes, FSaveSlotMetadata& OutMetadata)
+{
+	using namespace SaveMetadataSidecarPrivate;
+
+	if (Bytes.Num() != SerializedSize)
+	{
+		return false;
+	}
+
+	uint32 StoredCrc = 0;
+	FMemory::Memcpy(&StoredCrc, Bytes.GetData() + CrcOffset, sizeof(StoredCrc));
+	if (FCrc::MemCrc32(Bytes.GetData(), CrcOffset) != StoredCrc)
+	{
+		return false;
+	}
+
+	FMemoryReaderView Reader(Bytes, true);
+
+	uint32 MagicValue = 0;
+	uint16 Version = 0;
+	uint16 Flags = 0;
+	int64 Ticks = 0;
+	Reader << MagicValue << Version << Flags << Ticks;
+	if (MagicValue != Magic || Version > CurrentVersion)
+	{
+		return false;
+	}
+
+	OutMetadata.SaveTimestamp = FDateTime(Ticks);
+	Reader << OutMetadata.PlayTimeSeconds << OutMetadata.MasterSaveVersion << OutMetadata.SaveSizeBytes;
+	OutMetadata.SaveSlotName = ReadFixedString(Reader, SlotNameBytes);
+	OutMetadata.LevelName = ReadFixedString(Reader, LevelNameBytes);
+	OutMetadata.SaveDescription = ReadFixedString(Reader, DescriptionBytes);
+
+	return !Reader.IsError();
+}
+
+bool FSaveMetadataSidecar::Write(const FSaveSlotMetadata& Metadata)
+{
+	using namespace SaveMetadataSidecarPrivate;
+
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	if (!SaveSystem)
+	{
+		return false;
+	}
+
+	TArray<uint8> Bytes;
+	Encode(Metadata, Bytes);
+
+	return SaveSystem->SaveGame(false, *GetSidecarSlotName(Metadata.SaveSlotName), MetaUserIndex, Bytes)
+		&& UpdateCatalogue(Metadata.SaveSlotName, true);
+}
+
+bool FSaveMetadataSidecar::Read(const FString& SlotName, FSaveSlotMetadata& OutMetadata)
+{
+	TArray<uint8> Bytes;
+	if (!SaveMetadataSidecarPrivate::LoadSlot(GetSidecarSlotName(SlotName), Bytes) || !Decode(Bytes, OutMetadata))
+	{
+		return false;
+	}
+
+	// The stored name is cut to the fixed field size - the caller's slot name is the full one
+	OutMetadata.SaveSlotName = SlotName;
+	return true;
+}
+
+bool FSaveMetadataSidecar::Delete(const FString& SlotName)
+{
+	using namespace SaveMetadataSidecarPrivate;
+
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	if (!SaveSystem)
+	{
+		return false;
+	}
+
+	const FString SidecarSlotName = GetSidecarSlotName(SlotName);
+	const bool bDeleted = !SaveSystem->DoesSaveGameExist(*SidecarSlotName, MetaUserIndex)
+		|| SaveSystem->DeleteGame(false, *SidecarSlotName, MetaUserIndex);
+	return UpdateCatalogue(SlotName, false) && bDeleted;
+}
+
+void FSaveMetadataSidecar::ReadAll(TArray<FSaveSlotMetadata>& OutMetadata)
+{
+	using namespace SaveMetadataSidecarPrivate;
+
+	OutMetadata.Reset();
+
+	TArray<FString> SlotNames;
+	{
+		FScopeLock Lock(&CatalogueLock);
+		ReadCatalogue(SlotNames);
+	}
+
+	OutMetadata.Reserve(SlotNames.Num());
+	for (const FString& SlotName : SlotNames)
+	{
+		// Read keys the entry by the catalogued slot name, not the truncated stored name
+		FSaveSlotMetadata Metadata;
+		if (Read(SlotName, Metadata))
+		{
+			OutMetadata.Add(MoveTemp(Metadata));
+		}
+	}
+}
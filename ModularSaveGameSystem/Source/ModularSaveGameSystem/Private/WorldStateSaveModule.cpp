@@ -1,6 +1,7 @@
 // Copyright Windwalker Productions. All Rights Reserved.
 
 #include "WorldStateSaveModule.h"
+#include "Serialization/MemoryReader.h"
 
 UWorldStateSaveModule::UWorldStateSaveModule()
 {
@@ -15,20 +16,21 @@ void UWorldStateSaveModule::SaveActorState(const FActorSaveEnvelope& Envelope)
 		return;
 	}
 
-	FActorSaveEnvelopeMap& LevelMap = WorldActors.FindOrAdd(Envelope.LevelName);
+	FActorSaveEnvelopeMap& LevelMap = GetMutableLevel(Envelope.LevelName);
 	LevelMap.Actors.Add(Envelope.ActorSaveID, Envelope);
+	UnloggedActors.FindOrAdd(Envelope.LevelName).Add(Envelope.ActorSaveID);
 	UpdateTimestamp();
 }
 
 FActorSaveEnvelope UWorldStateSaveModule::LoadActorState(const FString& LevelName, const FString& ActorSaveID) const
 {
-	const FActorSaveEnvelopeMap* LevelMap = WorldActors.Find(LevelName);
+	const FWorldStateLevelRef* LevelMap = WorldActors.Find(LevelName);
 	if (!LevelMap)
 	{
 		return FActorSaveEnvelope();
 	}
 
-	const FActorSaveEnvelope* Envelope = LevelMap->Actors.Find(ActorSaveID);
+	const FActorSaveEnvelope* Envelope = (*LevelMap)->Actors.Find(ActorSaveID);
 	if (!Envelope)
 	{
 		return FActorSaveEnvelope();
@@ -41,31 +43,39 @@ TArray<FActorSaveEnvelope> UWorldStateSaveModule::GetAllActorsForLevel(const FSt
 {
 	TArray<FActorSaveEnvelope> Result;
 
-	const FActorSaveEnvelopeMap* LevelMap = WorldActors.Find(LevelName);
+	const FWorldStateLevelRef* LevelMap = WorldActors.Find(LevelName);
 	if (LevelMap)
 	{
-		LevelMap->Actors.GenerateValueArray(Result);
+		(*LevelMap)->Actors.GenerateValueArray(Result);
 	}
 
 	return Result;
 }
 
+const TMap<FString, FActorSaveEnvelope>* UWorldStateSaveModule::FindActorsForLevel(const FString& LevelName) const
+{
+	const FWorldStateLevelRef* LevelMap = WorldActors.Find(LevelName);
+	return LevelMap ? &(*LevelMap)->Actors : nullptr;
+}
+
 bool UWorldStateSaveModule::RemoveActorState(const FString& LevelName, const FString& ActorSaveID)
 {
-	FActorSaveEnvelopeMap* LevelMap = WorldActors.Find(LevelName);
-	if (!LevelMap)
+	const FWorldStateLevelRef* ExistingLevel = WorldActors.Find(LevelName);
+	if (!ExistingLevel || !(*ExistingLevel)->Actors.Contains(ActorSaveID))
 	{
 		return false;
 	}
 
-	const int32 Removed = LevelMap->Actors.Remove(ActorSaveID);
+	FActorSaveEnvelopeMap& LevelMap = GetMutableLevel(LevelName);
+	const int32 Removed = LevelMap.Actors.Remove(ActorSaveID);
 	if (Removed > 0)
 	{
 		// Clean up empty level entries
-		if (LevelMap->Actors.Num() == 0)
+		if (LevelMap.Actors.Num() == 0)
 		{
 			WorldActors.Remove(LevelName);
 		}
+		StructuralRevision++;
 		UpdateTimestamp();
 		return true;
 	}
@@ -75,19 +85,20 @@ bool UWorldStateSaveModule::RemoveActorState(const FString& LevelName, const FSt
 
 bool UWorldStateSaveModule::HasActorState(const FString& LevelName, const FString& ActorSaveID) const
 {
-	const FActorSaveEnvelopeMap* LevelMap = WorldActors.Find(LevelName);
+	const FWorldStateLevelRef* LevelMap = WorldActors.Find(LevelName);
 	if (!LevelMap)
 	{
 		return false;
 	}
 
-	return LevelMap->Actors.Contains(ActorSaveID);
+	return (*LevelMap)->Actors.Contains(ActorSaveID);
 }
 
 void UWorldStateSaveModule::ClearLevel(const FString& LevelName)
 {
 	if (WorldActors.Remove(LevelName) > 0)
 	{
+		StructuralRevision++;
 		UpdateTimestamp();
 	}
 }
@@ -102,6 +113,7 @@ TArray<FString> UWorldStateSaveModule::GetSavedLevelNames() const
 void UWorldStateSaveModule::ClearData()
 {
 	WorldActors.Empty();
+	StructuralRevision++;
 	UpdateTimestamp();
 }
 
@@ -111,17 +123,24 @@ bool UWorldStateSaveModule::ValidateData_Implementation()
 	for (auto& LevelPair : WorldActors)
 	{
 		TArray<FString> InvalidKeys;
-		for (const auto& ActorPair : LevelPair.Value.Actors)
+		for (const auto& ActorPair : LevelPair.Value->Actors)
 		{
 			if (!ActorPair.Value.IsValid())
 			{
 				InvalidKeys.Add(ActorPair.Key);
 			}
 		}
+		if (InvalidKeys.Num() == 0)
+		{
+			continue;
+		}
+
+		FActorSaveEnvelopeMap& LevelMap = GetMutableLevel(LevelPair.Key);
 		for (const FString& Key : InvalidKeys)
 		{
-			LevelPair.Value.Actors.Remove(Key);
+			LevelMap.Actors.Remove(Key);
 		}
+		StructuralRevision++;
 	}
 
 	return true;
@@ -131,3 +150,135 @@ void UWorldStateSaveModule::MigrateData_Implementation(int32 FromVersion, int32
 {
 	// Future: handle version migration
 }
+
+// ============================================================================
+// BACKGROUND SAVE SUPPORT
+// ============================================================================
+
+FActorSaveEnvelopeMap& UWorldStateSaveModule::GetMutableLevel(const FString& LevelName)
+{
+	if (FWorldStateLevelRef* Existing = WorldActors.Find(LevelName))
+	{
+		// Still referenced by a background save snapshot - detach before writing
+		if (!Existing->IsUnique())
+		{
+			*Existing = MakeShared<FActorSaveEnvelopeMap, ESPMode::ThreadSafe>(**Existing);
+		}
+		return Existing->Get();
+	}
+
+	return WorldActors.Add(LevelName, MakeShared<FActorSaveEnvelopeMap, ESPMode::ThreadSafe>()).Get();
+}
+
+bool UWorldStateSaveModule::AssembleEnvelope(const FSaveRecord& Record, const FString& LevelName, FActorSaveEnvelope& OutEnvelope)
+{
+	if (Record.BinaryData.Num() == 0)
+	{
+		return false;
+	}
+
+	FMemoryReader MemoryReader(Record.BinaryData, true);
+	FActorSaveEnvelope::StaticStruct()->SerializeBin(MemoryReader, &OutEnvelope);
+
+	if (MemoryReader.IsError() || !OutEnvelope.IsValid())
+	{
+		return false;
+	}
+
+	OutEnvelope.LevelName = LevelName;
+	return true;
+}
+
+void UWorldStateSaveModule::AdoptActorStates(TArray<FActorSaveEnvelope>&& Envelopes)
+{
+	FActorSaveEnvelopeMap* LevelMap = nullptr;
+	FString LevelMapName;
+
+	for (FActorSaveEnvelope& Envelope : Envelopes)
+	{
+		if (!Envelope.IsValid())
+		{
+			continue;
+		}
+
+		// Envelopes arrive grouped by level, so this is one level lookup per run
+		if (!LevelMap || LevelMapName != Envelope.LevelName)
+		{
+			LevelMap = &GetMutableLevel(Envelope.LevelName);
+			LevelMapName = Envelope.LevelName;
+		}
+
+		FString ActorSaveID = Envelope.ActorSaveID;
+		LevelMap->Actors.Add(MoveTemp(ActorSaveID), MoveTemp(Envelope));
+	}
+
+	Envelopes.Reset();
+	UpdateTimestamp();
+}
+
+void UWorldStateSaveModule::CollectUnloggedActorStates(TArray<FActorSaveEnvelope>& OutEnvelopes)
+{
+	for (const TPair<FString, TSet<FString>>& LevelPair : UnloggedActors)
+	{
+		const FWorldStateLevelRef* LevelMap = WorldActors.Find(LevelPair.Key);
+		if (!LevelMap)
+		{
+			continue;
+		}
+
+		// Removed since it was written - the structural revision already forces a full save
+		for (const FString& ActorSaveID : LevelPair.Value)
+		{
+			if (const FActorSaveEnvelope* Envelope = (*LevelMap)->Actors.Find(ActorSaveID))
+			{
+				OutEnvelopes.Add(*Envelope);
+			}
+		}
+	}
+
+	UnloggedActors.Reset();
+}
+
+void UWorldStateSaveModule::SerializeHeader(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+}
+
+void UWorldStateSaveModule::SerializeLevels(FArchive& Ar, FWorldStateLevels& Levels)
+{
+	int32 NumLevels = Levels.Num();
+	Ar << NumLevels;
+
+	if (Ar.IsLoading())
+	{
+		Levels.Reset();
+		Levels.Reserve(NumLevels);
+		for (int32 i = 0; i < NumLevels && !Ar.IsError(); ++i)
+		{
+			FString LevelName;
+			Ar << LevelName;
+			FWorldStateLevelRef LevelMap = MakeShared<FActorSaveEnvelopeMap, ESPMode::ThreadSafe>();
+			FActorSaveEnvelopeMap::StaticStruct()->SerializeBin(Ar, &LevelMap.Get());
+			Levels.Add(MoveTemp(LevelName), MoveTemp(LevelMap));
+		}
+	}
+	else
+	{
+		for (TPair<FString, FWorldStateLevelRef>& Pair : Levels)
+		{
+			Ar << Pair.Key;
+			FActorSaveEnvelopeMap::StaticStruct()->SerializeBin(Ar, &Pair.Value.Get());
+		}
+	}
+}
+
+void UWorldStateSaveModule::Serialize(FArchive& Ar)
+{
+	SerializeHeader(Ar);
+
+	// Level data is plain binary after the tagged module fields; skip for GC/reference walks
+	if (!Ar.IsObjectReferenceCollector() && !Ar.IsCountingMemory())
+	{
+		SerializeLevels(Ar, WorldActors);
+	}
+}
@@ -90,6 +90,10 @@ public:
 	UPROPERTY(SaveGame)
 	TMap<FString, UModularSaveData*> SaveModules;
 
+	/** Identifies the full save a slot's delta log builds on (new for every full save) */
+	UPROPERTY()
+	FGuid CheckpointId;
+
 	/** Subsystem-type saveable records (global, not per-level) */
 	UPROPERTY(SaveGame)
 	TMap<FString, FSaveRecord> SubsystemSaveRecords;
@@ -8,9 +8,12 @@
 #include "CharacterSaveModule.h"
 #include "UserSettingsSaveModule.h"
 #include "WorldStateSaveModule.h"
+#include "SaveSlotMetadata.h"
 #include "Delegates/ModularSaveGameSystem/SaveDelegates.h"
 #include "MasterSaveSubsystem.generated.h"
 
+struct FSaveContainerChunkPayload;
+
 /**
  * Subsystem that manages the master save game with modular components
  * This replaces the previous InventorySaveSubsystem with a more flexible approach
@@ -31,7 +34,7 @@ public:
 	 * Save the master save game (includes all modules)
 	 * @param SaveSlotName - Name of the save slot
 	 * @param bAsync - Whether to save asynchronously
-	 * @return true if save initiated successfully
+	 * @return true if save initiated successfully; false while a background save is running
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Master Save")
 	bool SaveGame(const FString& SaveSlotName = TEXT(""), bool bAsync = false);
@@ -39,11 +42,36 @@ public:
 	/**
 	 * Load the master save game (includes all modules)
 	 * @param SaveSlotName - Name of the save slot to load
-	 * @return true if load successful
+	 * @return true if load successful; false while a background save is running
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Master Save")
 	bool LoadGame(const FString& SaveSlotName = TEXT(""));
 
+	/**
+	 * Save without a game-thread hitch (autosave)
+	 * The game thread only snapshots dirty actor records and the small modules; envelope assembly,
+	 * world-state serialization, compression, checksums and disk I/O run on a worker.
+	 * Progress is reported through OnSaveProgress, completion through OnSaveComplete.
+	 * @param LevelName - Level the dirty actors belong to
+	 * @return false if there is no save game or a background save is already running
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Master Save")
+	bool SaveGameInBackground(const FString& SaveSlotName, const FString& LevelName);
+
+	/**
+	 * Frequent-autosave variant: appends only what changed since the slot's last full save
+	 * (dirty actor envelopes, small modules whose bytes changed) to the slot's delta log,
+	 * replayed on load. Falls back to SaveGameInBackground - which compacts everything into a
+	 * new base - when there is no base yet, saved world state was removed, or the log has grown
+	 * past 1/DELTA_COMPACTION_BASE_DIVISOR of the base (DELTA_COMPACTION_MIN_BYTES at least).
+	 * Every append rewrites the log, so this bounds its cost to a fraction of a full save.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Master Save")
+	bool SaveGameIncremental(const FString& SaveSlotName, const FString& LevelName);
+
+	UFUNCTION(BlueprintPure, Category = "Master Save")
+	bool IsBackgroundSaveInProgress() const { return bBackgroundSaveInProgress; }
+
 	/**
 	 * Quick save using current cached data
 	 */
@@ -58,6 +86,7 @@ public:
 
 	/**
 	 * Create a new master save game with all modules initialized
+	 * Returns nullptr while a background save is running
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Master Save")
 	UMasterSaveGame* CreateNewMasterSave(const FString& SaveSlotName = TEXT(""));
@@ -75,6 +104,10 @@ public:
 		if (!CurrentSaveGame)
 		{
 			CurrentSaveGame = CreateNewMasterSave();
+			if (!CurrentSaveGame)
+			{
+				return nullptr;
+			}
 		}
 
 		T* Module = CurrentSaveGame->GetModule<T>();
@@ -134,11 +167,32 @@ public:
 	bool DeleteSave(const FString& SaveSlotName);
 
 	/**
-	 * Get all available save slot names
+	 * Get all available save slot names (from the slot catalogue)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Master Save")
 	TArray<FString> GetAllSaveSlots() const;
 
+	// ========== Slot Catalogue ==========
+
+	/**
+	 * Re-read every slot's metadata sidecar on a worker and replace the catalogue on the game thread
+	 * Only the fixed-size sidecars are read, never the saves. Completion is reported through OnSlotCatalogueRefreshed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Master Save|Slots")
+	void RefreshSlotCatalogue();
+
+	/**
+	 * Cached metadata for every known slot, newest first (for the load-game menu)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Master Save|Slots")
+	TArray<FSaveSlotMetadata> GetSlotCatalogue() const;
+
+	/**
+	 * Metadata for one slot: the catalogue, then the slot's sidecar, then the save's master chunk
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Master Save|Slots")
+	bool GetSlotMetadata(const FString& SaveSlotName, FSaveSlotMetadata& OutMetadata) const;
+
 	/**
 	 * Get save file metadata
 	 */
@@ -197,9 +251,15 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Master Save")
 	FOnMasterSaveComplete OnSaveComplete;
 
+	UPROPERTY(BlueprintAssignable, Category = "Master Save")
+	FOnMasterSaveProgress OnSaveProgress;
+
 	UPROPERTY(BlueprintAssignable, Category = "Master Save")
 	FOnMasterLoadComplete OnLoadComplete;
 
+	UPROPERTY(BlueprintAssignable, Category = "Master Save|Slots")
+	FOnSaveSlotCatalogueRefreshed OnSlotCatalogueRefreshed;
+
 	UPROPERTY(BlueprintAssignable, Category = "Master Save|World State")
 	FOnWorldStateLoaded OnWorldStateLoaded;
 
@@ -215,6 +275,16 @@ protected:
 	void OnAsyncSaveComplete(const FString& SlotName, const int32 UserIndex, bool bSuccess);
 	void OnAsyncLoadComplete(const FString& SlotName, const int32 UserIndex, USaveGame* LoadedSave);
 
+	/** Game thread: run SaveState on dirty actor saveables and keep their bytes (cleared on success) */
+	void CollectDirtyActorRecords(TArray<FSaveRecord>& OutRecords);
+
+	/** Remember what a full save wrote so incremental saves can diff against it */
+	void RecordCheckpoint(const FString& SlotName, const TArray<FSaveContainerChunkPayload>& Chunks);
+
+	/** Game thread tail of background/incremental saves: hands the assembled envelopes to the module */
+	void FinishBackgroundSave(const FString& SlotName, UWorldStateSaveModule* WorldModule,
+		TArray<FActorSaveEnvelope>&& Envelopes, const FSaveSlotMetadata& Metadata, bool bSuccess);
+
 private:
 	// Current active save game
 	UPROPERTY()
@@ -223,6 +293,37 @@ private:
 	// Current save slot name for quick save/load
 	FString CurrentSaveSlotName;
 
+	// Only one background save (async full, background or incremental) writes a slot at a time
+	bool bBackgroundSaveInProgress = false;
+
+	// ========== Delta Log Checkpoint ==========
+
+	// Slot the current save's CheckpointId was written to / loaded from (empty = next save must be full)
+	FString CheckpointSlotName;
+
+	// World-state removals since the checkpoint force a full save
+	uint32 CheckpointWorldRevision = 0;
+
+	// CRC of each small chunk as last written, so unchanged modules stay out of the log
+	TMap<FString, uint32> CheckpointChunkCrcs;
+
+	// Size of the slot's delta log as last written or read (the log lives in the platform save system)
+	int64 CheckpointLogBytes = 0;
+
+	// Size of the base save the log builds on (0 until its write completes)
+	int64 CheckpointBaseBytes = 0;
+
+	// ========== Slot Catalogue ==========
+
+	// Slot name -> sidecar metadata, kept current by saves and deletes between refreshes
+	TMap<FString, FSaveSlotMetadata> SlotCatalogue;
+
+	// Delta log compacts into a new full save once it reaches this fraction of the base...
+	static const int64 DELTA_COMPACTION_BASE_DIVISOR;
+
+	// ...or this size, whichever is larger, so small saves don't compact on every append
+	static const int64 DELTA_COMPACTION_MIN_BYTES;
+
 	// Default save slot name
 	static const FString DEFAULT_SAVE_SLOT;
 
@@ -0,0 +1,156 @@
+// Copyright Windwalker Productions. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SubclassOf.h"
+
+class UMasterSaveGame;
+class UModularSaveData;
+
+/**
+ * Fixed-size header at offset 0 of a chunked save file
+ * File layout: [Header][Table of contents][Chunk data...]
+ */
+struct MODULARSAVEGAMESYSTEM_API FSaveContainerHeader
+{
+	static constexpr uint32 MagicNumber = 0x56535757; // "WWSV"
+	static constexpr uint16 CurrentFormatVersion = 1;
+	static constexpr int32 SerializedSize = 20;
+
+	uint32 Magic = MagicNumber;
+	uint16 FormatVersion = CurrentFormatVersion;
+	uint16 Flags = 0;
+	int32 NumChunks = 0;
+	int32 TocSize = 0;		// Bytes of table of contents, directly after the header
+	uint32 TocCrc = 0;		// CRC32 of the table of contents bytes
+
+	bool IsValid() const
+	{
+		return Magic == MagicNumber && FormatVersion <= CurrentFormatVersion && NumChunks >= 0 && TocSize >= 0;
+	}
+
+	/** Start of the chunk data section (chunk offsets are relative to this) */
+	int64 GetDataOffset() const { return SerializedSize + static_cast<int64>(TocSize); }
+
+	friend FArchive& operator<<(FArchive& Ar, FSaveContainerHeader& Header);
+};
+
+/** Table of contents entry - where one chunk lives and how to verify/inflate it */
+struct MODULARSAVEGAMESYSTEM_API FSaveContainerChunkEntry
+{
+	/** Three empty strings (length prefix only) + offset, sizes and CRCs */
+	static constexpr int32 MinSerializedSize = 3 * sizeof(int32) + sizeof(int64) + 2 * sizeof(int32) + 2 * sizeof(uint32);
+
+	/** Module key (class name, as in UMasterSaveGame::SaveModules) or a reserved chunk name */
+	FString Name;
+
+	/** Module class path, empty for reserved chunks */
+	FString ClassPath;
+
+	/** NAME_None = stored uncompressed */
+	FName CompressionFormat = NAME_None;
+
+	/** Relative to FSaveContainerHeader::GetDataOffset() */
+	int64 Offset = 0;
+	int32 StoredSize = 0;
+	int32 UncompressedSize = 0;
+
+	/** CRC32 of the stored bytes - checked before inflating */
+	uint32 StoredCrc = 0;
+
+	/** CRC32 of the inflated bytes - catches a bad inflate */
+	uint32 UncompressedCrc = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FSaveContainerChunkEntry& Entry);
+};
+
+/** One serialized, not yet compressed chunk. Built on the game thread, assembled on any thread. */
+struct FSaveContainerChunkPayload
+{
+	FString Name;
+	FString ClassPath;
+	TArray<uint8> Bytes;
+};
+
+/** Core save info carried by the master chunk */
+struct MODULARSAVEGAMESYSTEM_API FSaveContainerSaveInfo
+{
+	FString SaveSlotName;
+	FDateTime SaveTimestamp;
+	int32 MasterSaveVersion = 0;
+	FString SaveDescription;
+	FString LevelName;
+	float PlayTimeSeconds = 0.f;
+
+	friend FArchive& operator<<(FArchive& Ar, FSaveContainerSaveInfo& Info);
+};
+
+/**
+ * Chunked binary save format for UMasterSaveGame
+ *
+ * - Master info, subsystem records and every save module get their own chunk
+ * - Each chunk is compressed independently and carries its own CRCs, so one module
+ *   can be read or validated without inflating the others
+ * - A corrupt module chunk only loses that module; the rest of the save still loads
+ */
+class MODULARSAVEGAMESYSTEM_API FSaveContainer
+{
+public:
+	/** Reserved chunk names (module keys are class names, so these can't collide) */
+	static const TCHAR* MasterChunkName;
+	static const TCHAR* SubsystemRecordsChunkName;
+	static const TCHAR* CheckpointChunkName;
+
+	// ========== Writing ==========
+
+	/**
+	 * Serialize the save game into one payload per chunk (game thread - touches UObjects)
+	 * @param SkipModule - Left out; the caller adds its chunk itself (e.g. finished off the game thread)
+	 */
+	static void SerializeChunks(const UMasterSaveGame* SaveGame, TArray<FSaveContainerChunkPayload>& OutChunks,
+		const UModularSaveData* SkipModule = nullptr);
+
+	/** Compress, checksum and lay out the chunks into file bytes (thread-safe) */
+	static void Assemble(const TArray<FSaveContainerChunkPayload>& Chunks, TArray<uint8>& OutBytes,
+		FName CompressionFormat = NAME_Zlib);
+
+	/** SerializeChunks + Assemble */
+	static void Write(const UMasterSaveGame* SaveGame, TArray<uint8>& OutBytes);
+
+	// ========== Reading ==========
+
+	/** True if the bytes start with a container header (otherwise a legacy UGameplayStatics save) */
+	static bool IsContainer(TConstArrayView<uint8> Bytes);
+
+	/** Parse and verify the header and table of contents only */
+	static bool ReadTableOfContents(TConstArrayView<uint8> Bytes, FSaveContainerHeader& OutHeader,
+		TArray<FSaveContainerChunkEntry>& OutEntries);
+
+	/** Verify and inflate a single chunk */
+	static bool ReadChunk(TConstArrayView<uint8> Bytes, const FSaveContainerHeader& Header,
+		const FSaveContainerChunkEntry& Entry, TArray<uint8>& OutBytes);
+
+	/**
+	 * Rebuild a full save game. Corrupt module chunks are skipped (and reported);
+	 * returns nullptr only if the table of contents or master chunk is unusable.
+	 */
+	static UMasterSaveGame* Read(TConstArrayView<uint8> Bytes, TArray<FString>* OutCorruptChunks = nullptr);
+
+	/**
+	 * Apply one inflated chunk to a save game (master info, subsystem records, checkpoint or a module,
+	 * replacing any module with the same key). Also used to replay delta log records.
+	 */
+	static bool ApplyChunk(UMasterSaveGame* SaveGame, const FString& Name, const FString& ClassPath,
+		const TArray<uint8>& ChunkBytes);
+
+	/** Inflate and rebuild just one module. Returns nullptr if missing or corrupt. */
+	static UModularSaveData* ReadModule(TConstArrayView<uint8> Bytes, TSubclassOf<UModularSaveData> ModuleClass,
+		UObject* Outer);
+
+	/** Inflate just the master chunk */
+	static bool ReadSaveInfo(TConstArrayView<uint8> Bytes, FSaveContainerSaveInfo& OutInfo);
+
+	/** Check every chunk's CRCs and inflate. Returns true if nothing is corrupt. */
+	static bool Validate(TConstArrayView<uint8> Bytes, TArray<FString>& OutCorruptChunks);
+};
@@ -0,0 +1,66 @@
+// Copyright Windwalker Productions. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveContainer.h"
+#include "Lib/Data/ModularSaveGameSystem/ActorSaveData.h"
+
+class UMasterSaveGame;
+
+/** What a delta record carries */
+enum class ESaveDeltaRecordType : uint8
+{
+	/** A container chunk (master info, subsystem records or a whole module) - replaces the base's */
+	Chunk,
+	/** Actor envelopes (Chunk.Name = level the save was made for, each envelope carries its own) - upserted into the world-state module */
+	ActorEnvelopes
+};
+
+struct MODULARSAVEGAMESYSTEM_API FSaveDeltaRecord
+{
+	ESaveDeltaRecordType Type = ESaveDeltaRecordType::Chunk;
+	FSaveContainerChunkPayload Chunk;
+
+	friend FArchive& operator<<(FArchive& Ar, FSaveDeltaRecord& Record);
+};
+
+/**
+ * Append-only per-slot log of what changed since the slot's last full save (the checkpoint)
+ *
+ * File layout: [Header: magic, version, checkpoint id][Batch]...
+ * Each batch is one incremental save: size + CRC framed, so a torn tail write
+ * drops only that save, and the next append cuts the log back to its last intact batch.
+ * A log whose checkpoint id differs from the base save's is stale (the base was
+ * rewritten after it) and is ignored.
+ *
+ * Stored through ISaveGameSystem as its own slot (<Slot>_delta) so it lives wherever the
+ * platform keeps the base save. ISaveGameSystem has no append, so every append rewrites the whole
+ * log - UMasterSaveSubsystem compacts it once it reaches a small fraction of the base save.
+ */
+class MODULARSAVEGAMESYSTEM_API FSaveDeltaLog
+{
+public:
+	/** Platform save slot holding a slot's log */
+	static FString GetLogSlotName(const FString& SlotName);
+
+	/**
+	 * Append one batch (thread-safe; one writer per slot). Starts a new log if the checkpoint changed,
+	 * drops a torn or corrupt tail left by an earlier write. OutLogBytes receives the log's new size.
+	 */
+	static bool AppendBatch(const FString& SlotName, const FGuid& CheckpointId, const TArray<FSaveDeltaRecord>& Records, int64* OutLogBytes = nullptr);
+
+	/**
+	 * Every intact batch for the checkpoint, in write order. Stops at the first torn or corrupt batch.
+	 * OutLogBytes receives the size of the intact part of the log.
+	 */
+	static bool ReadRecords(const FString& SlotName, const FGuid& CheckpointId, TArray<FSaveDeltaRecord>& OutRecords, int64* OutLogBytes = nullptr);
+
+	/** Replay records onto a freshly loaded base save (game thread) */
+	static void Apply(UMasterSaveGame* SaveGame, const TArray<FSaveDeltaRecord>& Records);
+
+	static bool Delete(const FString& SlotName);
+
+	/** Envelope list payload for an ActorEnvelopes record (thread-safe) */
+	static void SerializeEnvelopes(FArchive& Ar, TArray<FActorSaveEnvelope>& Envelopes);
+};
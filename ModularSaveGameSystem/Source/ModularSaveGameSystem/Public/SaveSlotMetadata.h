@@ -0,0 +1,74 @@
+// Copyright Windwalker Productions. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SaveSlotMetadata.generated.h"
+
+class UMasterSaveGame;
+
+/**
+ * What the load-game menu shows for a slot
+ * Written next to every save as a small fixed-size sidecar, so browsing slots never opens the saves.
+ */
+USTRUCT(BlueprintType)
+struct MODULARSAVEGAMESYSTEM_API FSaveSlotMetadata
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Save Info")
+	FString SaveSlotName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Save Info")
+	FDateTime SaveTimestamp;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Save Info")
+	int32 MasterSaveVersion = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Save Info")
+	FString SaveDescription;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Save Info")
+	FString LevelName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Save Info")
+	float PlayTimeSeconds = 0.f;
+
+	/** Size of the slot's base save file */
+	UPROPERTY(BlueprintReadOnly, Category = "Save Info")
+	int64 SaveSizeBytes = 0;
+};
+
+/**
+ * Fixed 512-byte metadata sidecar, stored through ISaveGameSystem as slot <Slot>_meta
+ *
+ * Layout: magic, version, timestamp ticks, playtime, save version, size, then fixed-width
+ * UTF-8 fields (slot 64, level 128, description 284 bytes, truncated on a character
+ * boundary) and a trailing CRC32. A catalogue slot lists every slot that has a sidecar,
+ * since save systems can't be enumerated portably. Everything except FromSaveGame is thread-safe.
+ */
+class MODULARSAVEGAMESYSTEM_API FSaveMetadataSidecar
+{
+public:
+	static constexpr int32 SerializedSize = 512;
+
+	static FString GetSidecarSlotName(const FString& SlotName);
+
+	/** Snapshot the fields from a save game (game thread) */
+	static FSaveSlotMetadata FromSaveGame(const UMasterSaveGame* SaveGame, int64 SaveSizeBytes);
+
+	static void Encode(const FSaveSlotMetadata& Metadata, TArray<uint8>& OutBytes);
+	static bool Decode(TConstArrayView<uint8> Bytes, FSaveSlotMetadata& OutMetadata);
+
+	/** Writes the sidecar and adds the slot to the catalogue */
+	static bool Write(const FSaveSlotMetadata& Metadata);
+
+	/** Reads exactly SerializedSize bytes */
+	static bool Read(const FString& SlotName, FSaveSlotMetadata& OutMetadata);
+
+	/** Deletes the sidecar and drops the slot from the catalogue */
+	static bool Delete(const FString& SlotName);
+
+	/** Every readable sidecar listed in the catalogue */
+	static void ReadAll(TArray<FSaveSlotMetadata>& OutMetadata);
+};
@@ -20,6 +20,10 @@ struct FActorSaveEnvelopeMap
 	TMap<FString, FActorSaveEnvelope> Actors;
 };
 
+/** Level maps are shared copy-on-write between the module and in-flight background saves */
+using FWorldStateLevelRef = TSharedRef<FActorSaveEnvelopeMap, ESPMode::ThreadSafe>;
+using FWorldStateLevels = TMap<FString, FWorldStateLevelRef>;
+
 /**
  * UWorldStateSaveModule — Dedicated per-level, per-actor save module.
  * Stores FActorSaveEnvelope data keyed by LevelName -> ActorSaveID.
@@ -51,6 +55,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "World State Save")
 	TArray<FActorSaveEnvelope> GetAllActorsForLevel(const FString& LevelName) const;
 
+	/** C++ only: a level's envelopes keyed by ActorSaveID, without copying them. nullptr if none. */
+	const TMap<FString, FActorSaveEnvelope>* FindActorsForLevel(const FString& LevelName) const;
+
 	/** Remove a specific actor's save data. */
 	UFUNCTION(BlueprintCallable, Category = "World State Save")
 	bool RemoveActorState(const FString& LevelName, const FString& ActorSaveID);
@@ -67,16 +74,57 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "World State Save")
 	TArray<FString> GetSavedLevelNames() const;
 
-	// ========== UModularSaveData Overrides ==========
+	// ========== Background Save Support ==========
+
+	/** Build an envelope from a saveable's SaveState record (thread-safe). False if it holds no valid envelope. */
+	static bool AssembleEnvelope(const FSaveRecord& Record, const FString& LevelName, FActorSaveEnvelope& OutEnvelope);
+
+	/** Store many envelopes at once, moving them in */
+	void AdoptActorStates(TArray<FActorSaveEnvelope>&& Envelopes);
+
+	/** O(levels) snapshot - level maps stay shared until either side writes to them */
+	FWorldStateLevels GetLevelsSnapshot() const { return WorldActors; }
+
+	/** Bumped whenever saved state is removed rather than overwritten (delta saves only carry upserts) */
+	uint32 GetStructuralRevision() const { return StructuralRevision; }
+
+	/**
+	 * Copies of the envelopes written through SaveActorState since the last reset, grouped by level,
+	 * then forgets them. Incremental saves log these - the actors were marked clean when they were written.
+	 */
+	void CollectUnloggedActorStates(TArray<FActorSaveEnvelope>& OutEnvelopes);
+
+	/** Forget the SaveActorState writes - a full save or load now holds them */
+	void ResetUnloggedActorStates() { UnloggedActors.Reset(); }
 
+	/** Module fields only - everything Serialize writes before the level data */
+	void SerializeHeader(FArchive& Ar);
+
+	/** Level data in the layout Serialize writes after the header (thread-safe on a snapshot) */
+	static void SerializeLevels(FArchive& Ar, FWorldStateLevels& Levels);
+
+	// ========== UObject / UModularSaveData Overrides ==========
+
+	virtual void Serialize(FArchive& Ar) override;
 	virtual void ClearData() override;
 	virtual bool ValidateData_Implementation() override;
 	virtual void MigrateData_Implementation(int32 FromVersion, int32 ToVersion) override;
 
 private:
-	/** Outer key: LevelName -> Inner: ActorSaveID -> FActorSaveEnvelope */
-	UPROPERTY(SaveGame)
-	TMap<FString, FActorSaveEnvelopeMap> WorldActors;
+	/** Level map for writing - clones it first if a background save still shares it */
+	FActorSaveEnvelopeMap& GetMutableLevel(const FString& LevelName);
+
+	/**
+	 * Outer key: LevelName -> Inner: ActorSaveID -> FActorSaveEnvelope
+	 * Not a UPROPERTY: Serialize writes it explicitly so background saves can produce
+	 * the same bytes from a snapshot without touching this object.
+	 */
+	FWorldStateLevels WorldActors;
+
+	uint32 StructuralRevision = 0;
+
+	/** LevelName -> ActorSaveIDs written through SaveActorState that no full save or delta batch holds yet */
+	TMap<FString, TSet<FString>> UnloggedActors;
 
 	static const int32 CURRENT_MODULE_VERSION = 1;
 };
@@ -414,5 +414,5 @@ void UDurabilityComponent::OnSaveDataLoaded_Implementation()
 
 void UDurabilityComponent::MarkSaveDirty()
 {
-    bSaveDirty = true;
+    USaveableRegistrySubsystem::PushDirty(this, bSaveDirty);
 }
@@ -1,6 +1,7 @@
 ﻿// Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ModularSystemsBase.h"
+#include "Utilities/Helpers/Item/ItemDefinitionCache.h"
 
 #define LOCTEXT_NAMESPACE "FModularSystemsBaseModule"
 
@@ -13,6 +14,7 @@ void FModularSystemsBaseModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FItemDefinitionCache::ReleaseAll();
 }
 
 #undef LOCTEXT_NAMESPACE
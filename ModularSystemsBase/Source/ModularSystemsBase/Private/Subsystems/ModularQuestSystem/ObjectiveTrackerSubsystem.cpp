@@ -1,32 +1,52 @@
 // ObjectiveTrackerSubsystem.cpp
 #include "Subsystems/ModularQuestSystem/ObjectiveTrackerSubsystem.h"
+#include "Subsystems/EventBusSubsystem.h"
+#include "Engine/GameInstance.h"
 #include "Engine/World.h"
 
 void UObjectiveTrackerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
+    CachedEventBus = Collection.InitializeDependency<UEventBusSubsystem>();
 }
 
 void UObjectiveTrackerSubsystem::Deinitialize()
 {
+    if (CachedEventBus)
+    {
+        CachedEventBus->UnsubscribeAll(this);
+    }
+    EventSubscriptions.Empty();
+    EventInstigators.Empty();
     TrackedSets.Empty();
+    ObjectivesByTag.Empty();
     Super::Deinitialize();
 }
 
 // === REGISTRATION ===
 
-FGuid UObjectiveTrackerSubsystem::RegisterObjectiveSet(const FObjectiveSet& Definition)
+FGuid UObjectiveTrackerSubsystem::RegisterObjectiveSet(const FObjectiveSet& Definition, AActor* EventInstigator)
 {
     FTrackedObjectiveSet NewSet;
     NewSet.Initialize(Definition);
     
+    if (EventInstigator)
+    {
+        EventInstigators.Add(NewSet.SetID, EventInstigator);
+    }
+    IndexSet(NewSet);
     TrackedSets.Add(NewSet.SetID, NewSet);
     return NewSet.SetID;
 }
 
 void UObjectiveTrackerSubsystem::UnregisterObjectiveSet(const FGuid& SetID)
 {
-    TrackedSets.Remove(SetID);
+    if (const FTrackedObjectiveSet* Set = TrackedSets.Find(SetID))
+    {
+        UnindexSet(*Set);
+        EventInstigators.Remove(SetID);
+        TrackedSets.Remove(SetID);
+    }
 }
 
 bool UObjectiveTrackerSubsystem::IsSetRegistered(const FGuid& SetID) const
@@ -58,6 +78,35 @@ void UObjectiveTrackerSubsystem::CompleteObjective(const FGuid& SetID, const FGa
     UpdateObjectiveInternal(SetID, ObjectiveTag, Entry->Condition.TargetValue);
 }
 
+int32 UObjectiveTrackerSubsystem::AddObjectiveValueForTag(const FGameplayTag& EventTag, float Delta)
+{
+    // Copy - completion delegates may unregister sets while we update
+    TArray<FObjectiveRef> Refs;
+    FindObjectivesForTag(EventTag, Refs);
+
+    for (const FObjectiveRef& Ref : Refs)
+    {
+        const FTrackedObjectiveSet* Set = TrackedSets.Find(Ref.SetID);
+        if (Set && Set->States.IsValidIndex(Ref.EntryIndex))
+        {
+            UpdateObjectiveAt(Ref.SetID, Ref.EntryIndex, Set->States[Ref.EntryIndex].CurrentValue + Delta);
+        }
+    }
+    return Refs.Num();
+}
+
+int32 UObjectiveTrackerSubsystem::SetObjectiveValueForTag(const FGameplayTag& EventTag, float Value)
+{
+    TArray<FObjectiveRef> Refs;
+    FindObjectivesForTag(EventTag, Refs);
+
+    for (const FObjectiveRef& Ref : Refs)
+    {
+        UpdateObjectiveAt(Ref.SetID, Ref.EntryIndex, Value);
+    }
+    return Refs.Num();
+}
+
 void UObjectiveTrackerSubsystem::ResetObjective(const FGuid& SetID, const FGameplayTag& ObjectiveTag)
 {
     FTrackedObjectiveSet* Set = TrackedSets.Find(SetID);
@@ -143,6 +192,19 @@ float UObjectiveTrackerSubsystem::GetSetProgress(const FGuid& SetID) const
     return Set ? Set->GetProgress() : 0.0f;
 }
 
+TArray<FGuid> UObjectiveTrackerSubsystem::GetSetsForTag(const FGameplayTag& EventTag) const
+{
+    TArray<FObjectiveRef> Refs;
+    FindObjectivesForTag(EventTag, Refs);
+
+    TArray<FGuid> SetIDs;
+    for (const FObjectiveRef& Ref : Refs)
+    {
+        SetIDs.AddUnique(Ref.SetID);
+    }
+    return SetIDs;
+}
+
 const FTrackedObjectiveSet* UObjectiveTrackerSubsystem::GetTrackedSet(const FGuid& SetID) const
 {
     return TrackedSets.Find(SetID);
@@ -150,22 +212,127 @@ const FTrackedObjectiveSet* UObjectiveTrackerSubsystem::GetTrackedSet(const FGui
 
 // === INTERNAL ===
 
+void UObjectiveTrackerSubsystem::IndexSet(const FTrackedObjectiveSet& Set)
+{
+    for (int32 i = 0; i < Set.Definition.Entries.Num(); i++)
+    {
+        const FGameplayTag ObjectiveTag = Set.Definition.Entries[i].GetObjectiveTag();
+        if (ObjectiveTag.IsValid())
+        {
+            TArray<FObjectiveRef>& Refs = ObjectivesByTag.FindOrAdd(ObjectiveTag);
+            if (Refs.Num() == 0)
+            {
+                SubscribeObjectiveTag(ObjectiveTag);
+            }
+            Refs.Add({ Set.SetID, i });
+        }
+    }
+}
+
+void UObjectiveTrackerSubsystem::UnindexSet(const FTrackedObjectiveSet& Set)
+{
+    for (const FObjectiveEntry& Entry : Set.Definition.Entries)
+    {
+        TArray<FObjectiveRef>* Refs = ObjectivesByTag.Find(Entry.GetObjectiveTag());
+        if (!Refs) continue;
+
+        Refs->RemoveAllSwap([&Set](const FObjectiveRef& Ref) { return Ref.SetID == Set.SetID; }, EAllowShrinking::No);
+        if (Refs->Num() == 0)
+        {
+            ObjectivesByTag.Remove(Entry.GetObjectiveTag());
+            UnsubscribeObjectiveTag(Entry.GetObjectiveTag());
+        }
+    }
+}
+
+void UObjectiveTrackerSubsystem::SubscribeObjectiveTag(const FGameplayTag& ObjectiveTag)
+{
+    if (!CachedEventBus) return;
+
+    EventSubscriptions.Add(ObjectiveTag, CachedEventBus->SubscribeNative(ObjectiveTag,
+        FGameplayEventNativeHandler::CreateUObject(this, &UObjectiveTrackerSubsystem::HandleObjectiveEvent, ObjectiveTag)));
+}
+
+void UObjectiveTrackerSubsystem::UnsubscribeObjectiveTag(const FGameplayTag& ObjectiveTag)
+{
+    FEventBusSubscriptionHandle Handle;
+    if (CachedEventBus && EventSubscriptions.RemoveAndCopyValue(ObjectiveTag, Handle))
+    {
+        CachedEventBus->Unsubscribe(Handle);
+    }
+}
+
+void UObjectiveTrackerSubsystem::HandleObjectiveEvent(const FGameplayEventPayload& Payload, FGameplayTag ObjectiveTag)
+{
+    if (bApplyingEvent || !Payload.Instigator || EventInstigators.Num() == 0) return;
+
+    const TArray<FObjectiveRef>* Refs = ObjectivesByTag.Find(ObjectiveTag);
+    if (!Refs) return;
+
+    // Only sets registered for this instigator - other players' sets on the same tag stay untouched
+    TArray<FObjectiveRef, TInlineAllocator<4>> Matching;
+    for (const FObjectiveRef& Ref : *Refs)
+    {
+        const TWeakObjectPtr<AActor>* Instigator = EventInstigators.Find(Ref.SetID);
+        if (Instigator && Instigator->Get() == Payload.Instigator)
+        {
+            Matching.Add(Ref);
+        }
+    }
+    if (Matching.Num() == 0) return;
+
+    const float Delta = Payload.Value != 0.0f ? Payload.Value
+        : (Payload.IntValue != 0 ? static_cast<float>(Payload.IntValue) : 1.0f);
+
+    TGuardValue<bool> ApplyingGuard(bApplyingEvent, true);
+    for (const FObjectiveRef& Ref : Matching)
+    {
+        // Completion delegates may unregister sets while we update
+        const FTrackedObjectiveSet* Set = TrackedSets.Find(Ref.SetID);
+        if (Set && Set->States.IsValidIndex(Ref.EntryIndex))
+        {
+            UpdateObjectiveAt(Ref.SetID, Ref.EntryIndex, Set->States[Ref.EntryIndex].CurrentValue + Delta);
+        }
+    }
+}
+
+void UObjectiveTrackerSubsystem::FindObjectivesForTag(const FGameplayTag& EventTag, TArray<FObjectiveRef>& OutRefs) const
+{
+    if (!EventTag.IsValid() || ObjectivesByTag.Num() == 0) return;
+
+    // A.B.C reaches objectives on A.B.C, A.B and A - one map lookup per tag level
+    for (const FGameplayTag& Tag : EventTag.GetGameplayTagParents())
+    {
+        if (const TArray<FObjectiveRef>* Refs = ObjectivesByTag.Find(Tag))
+        {
+            OutRefs.Append(*Refs);
+        }
+    }
+}
+
 void UObjectiveTrackerSubsystem::UpdateObjectiveInternal(const FGuid& SetID, const FGameplayTag& ObjectiveTag, float NewValue)
 {
-    FTrackedObjectiveSet* Set = TrackedSets.Find(SetID);
+    const FTrackedObjectiveSet* Set = TrackedSets.Find(SetID);
     if (!Set) return;
 
-    bool bNewlyMet = Set->UpdateObjective(ObjectiveTag, NewValue, GetWorldTime());
+    UpdateObjectiveAt(SetID, Set->Definition.FindEntryIndex(ObjectiveTag), NewValue);
+}
+
+void UObjectiveTrackerSubsystem::UpdateObjectiveAt(const FGuid& SetID, int32 EntryIndex, float NewValue)
+{
+    FTrackedObjectiveSet* Set = TrackedSets.Find(SetID);
+    // Definition.Entries and States are separate arrays - both must cover the entry
+    if (!Set || !Set->Definition.Entries.IsValidIndex(EntryIndex) || !Set->States.IsValidIndex(EntryIndex)) return;
+
+    const FGameplayTag ObjectiveTag = Set->Definition.Entries[EntryIndex].GetObjectiveTag();
+    bool bNewlyMet = Set->UpdateObjectiveAt(EntryIndex, NewValue, GetWorldTime());
+    const float MetTimestamp = Set->States[EntryIndex].MetTimestamp;
 
     OnObjectiveUpdated.Broadcast(SetID, ObjectiveTag, NewValue);
 
     if (bNewlyMet)
     {
-        int32 Index = Set->Definition.FindEntryIndex(ObjectiveTag);
-        if (Index != INDEX_NONE)
-        {
-            OnObjectiveMet.Broadcast(SetID, ObjectiveTag, Set->States[Index].MetTimestamp);
-        }
+        OnObjectiveMet.Broadcast(SetID, ObjectiveTag, MetTimestamp);
         CheckCompletion(SetID);
     }
 }
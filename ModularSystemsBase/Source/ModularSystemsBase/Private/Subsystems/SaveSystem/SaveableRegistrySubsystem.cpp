@@ -2,6 +2,18 @@
 
 #include "Subsystems/SaveSystem/SaveableRegistrySubsystem.h"
 #include "Interfaces/ModularSaveGameSystem/SaveableInterface.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+
+namespace SaveableRegistryPrivate
+{
+	struct FPriorityProjection
+	{
+		int32 operator()(const TPair<int32, FString>& Entry) const { return Entry.Key; }
+	};
+}
 
 void USaveableRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -11,7 +23,9 @@ void USaveableRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection
 void USaveableRegistrySubsystem::Deinitialize()
 {
 	RegisteredSaveables.Empty();
+	CachedPriorities.Empty();
 	PrioritySortedIDs.Empty();
+	DirtySaveIDs.Empty();
 	Super::Deinitialize();
 }
 
@@ -39,29 +53,50 @@ USaveableRegistrySubsystem* USaveableRegistrySubsystem::Get(const UObject* World
 
 bool USaveableRegistrySubsystem::RegisterSaveable(UObject* SaveableObject)
 {
-	if (!SaveableObject || !SaveableObject->GetClass()->ImplementsInterface(USaveableInterface::StaticClass()))
+	int32 Priority = 0;
+	const FString SaveID = AddToRegistry(SaveableObject, Priority);
+	if (SaveID.IsEmpty())
 	{
 		return false;
 	}
 
-	const FString SaveID = ISaveableInterface::Execute_GetSaveID(SaveableObject);
-	if (SaveID.IsEmpty())
+	InsertSorted(Priority, SaveID);
+
+	OnSaveableRegistered.Broadcast(SaveID, Priority);
+
+	return true;
+}
+
+int32 USaveableRegistrySubsystem::RegisterSaveables(const TArray<UObject*>& SaveableObjects)
+{
+	TArray<TPair<int32, FString>> Added;
+	Added.Reserve(SaveableObjects.Num());
+
+	for (UObject* SaveableObject : SaveableObjects)
 	{
-		return false;
+		int32 Priority = 0;
+		FString SaveID = AddToRegistry(SaveableObject, Priority);
+		if (!SaveID.IsEmpty())
+		{
+			Added.Emplace(Priority, MoveTemp(SaveID));
+		}
 	}
 
-	if (RegisteredSaveables.Contains(SaveID))
+	if (Added.Num() == 0)
 	{
-		return false;
+		return 0;
 	}
 
-	RegisteredSaveables.Add(SaveID, SaveableObject);
-	RebuildPriorityCache();
+	// One stable sort on cached priorities keeps registration order within a priority
+	PrioritySortedIDs.Append(Added);
+	Algo::StableSortBy(PrioritySortedIDs, SaveableRegistryPrivate::FPriorityProjection());
 
-	const int32 Priority = ISaveableInterface::Execute_GetSavePriority(SaveableObject);
-	OnSaveableRegistered.Broadcast(SaveID, Priority);
+	for (const TPair<int32, FString>& Entry : Added)
+	{
+		OnSaveableRegistered.Broadcast(Entry.Value, Entry.Key);
+	}
 
-	return true;
+	return Added.Num();
 }
 
 bool USaveableRegistrySubsystem::UnregisterSaveable(const FString& SaveID)
@@ -72,7 +107,13 @@ bool USaveableRegistrySubsystem::UnregisterSaveable(const FString& SaveID)
 	}
 
 	RegisteredSaveables.Remove(SaveID);
-	RebuildPriorityCache();
+	DirtySaveIDs.Remove(SaveID);
+
+	int32 Priority = 0;
+	if (CachedPriorities.RemoveAndCopyValue(SaveID, Priority))
+	{
+		RemoveSorted(Priority, SaveID);
+	}
 
 	OnSaveableUnregistered.Broadcast(SaveID);
 
@@ -86,13 +127,28 @@ TArray<UObject*> USaveableRegistrySubsystem::GetAllSaveables() const
 
 TArray<UObject*> USaveableRegistrySubsystem::GetDirtySaveables() const
 {
+	TArray<TPair<int32, FString>> DirtyIDs;
+	DirtyIDs.Reserve(DirtySaveIDs.Num());
+	for (const FString& SaveID : DirtySaveIDs)
+	{
+		if (const int32* Priority = CachedPriorities.Find(SaveID))
+		{
+			DirtyIDs.Emplace(*Priority, SaveID);
+		}
+	}
+
+	Algo::StableSortBy(DirtyIDs, SaveableRegistryPrivate::FPriorityProjection());
+
 	TArray<UObject*> Result;
-	for (const TPair<int32, FString>& Pair : PrioritySortedIDs)
+	Result.Reserve(DirtyIDs.Num());
+	for (const TPair<int32, FString>& Pair : DirtyIDs)
 	{
 		const TWeakObjectPtr<UObject>* WeakPtr = RegisteredSaveables.Find(Pair.Value);
 		if (WeakPtr && WeakPtr->IsValid())
 		{
 			UObject* Obj = WeakPtr->Get();
+
+			// The flag can be cleared outside the registry (an actor clearing its components)
 			if (ISaveableInterface::Execute_IsDirty(Obj))
 			{
 				Result.Add(Obj);
@@ -119,33 +175,138 @@ int32 USaveableRegistrySubsystem::GetSaveableCount() const
 
 void USaveableRegistrySubsystem::MarkAllClean()
 {
-	for (auto& Pair : RegisteredSaveables)
+	for (const FString& SaveID : DirtySaveIDs)
+	{
+		const TWeakObjectPtr<UObject>* WeakPtr = RegisteredSaveables.Find(SaveID);
+		if (WeakPtr && WeakPtr->IsValid())
+		{
+			ISaveableInterface::Execute_ClearDirty(WeakPtr->Get());
+		}
+	}
+	DirtySaveIDs.Reset();
+}
+
+void USaveableRegistrySubsystem::MarkSaveableDirty(UObject* SaveableObject)
+{
+	if (!AddDirty(SaveableObject))
 	{
-		if (Pair.Value.IsValid())
+		return;
+	}
+
+	// Components are saved inside their owner's envelope when the owner is saveable
+	if (const UActorComponent* Component = Cast<UActorComponent>(SaveableObject))
+	{
+		AActor* Owner = Component->GetOwner();
+		if (Owner && Owner->GetClass()->ImplementsInterface(USaveableInterface::StaticClass()))
 		{
-			ISaveableInterface::Execute_ClearDirty(Pair.Value.Get());
+			AddDirty(Owner);
 		}
 	}
 }
 
-void USaveableRegistrySubsystem::RebuildPriorityCache()
+void USaveableRegistrySubsystem::PushDirty(UObject* SaveableObject, bool& bDirtyFlag)
+{
+	// Already in the dirty set since the last ClearDirty
+	if (bDirtyFlag)
+	{
+		return;
+	}
+	bDirtyFlag = true;
+
+	if (USaveableRegistrySubsystem* Registry = Get(SaveableObject))
+	{
+		Registry->MarkSaveableDirty(SaveableObject);
+	}
+}
+
+void USaveableRegistrySubsystem::MarkSaveableClean(UObject* SaveableObject)
 {
-	PrioritySortedIDs.Empty(RegisteredSaveables.Num());
+	if (!SaveableObject || !SaveableObject->GetClass()->ImplementsInterface(USaveableInterface::StaticClass()))
+	{
+		return;
+	}
+
+	ISaveableInterface::Execute_ClearDirty(SaveableObject);
+	DirtySaveIDs.Remove(ISaveableInterface::Execute_GetSaveID(SaveableObject));
 
-	for (const auto& Pair : RegisteredSaveables)
+	// An actor saves its components in its envelope and may have cleared them along with itself
+	if (const AActor* Actor = Cast<AActor>(SaveableObject))
 	{
-		if (Pair.Value.IsValid())
+		TInlineComponentArray<UActorComponent*> Components(Actor);
+		for (UActorComponent* Component : Components)
 		{
-			const int32 Priority = ISaveableInterface::Execute_GetSavePriority(Pair.Value.Get());
-			PrioritySortedIDs.Emplace(Priority, Pair.Key);
+			if (Component && Component->GetClass()->ImplementsInterface(USaveableInterface::StaticClass())
+				&& !ISaveableInterface::Execute_IsDirty(Component))
+			{
+				DirtySaveIDs.Remove(ISaveableInterface::Execute_GetSaveID(Component));
+			}
 		}
 	}
+}
 
-	// Sort ascending: lower priority number = loads first
-	PrioritySortedIDs.Sort([](const TPair<int32, FString>& A, const TPair<int32, FString>& B)
+bool USaveableRegistrySubsystem::AddDirty(UObject* SaveableObject)
+{
+	if (!SaveableObject || !SaveableObject->GetClass()->ImplementsInterface(USaveableInterface::StaticClass()))
+	{
+		return false;
+	}
+
+	FString SaveID = ISaveableInterface::Execute_GetSaveID(SaveableObject);
+	if (!RegisteredSaveables.Contains(SaveID))
 	{
-		return A.Key < B.Key;
-	});
+		return false;
+	}
+
+	DirtySaveIDs.Add(MoveTemp(SaveID));
+	return true;
+}
+
+FString USaveableRegistrySubsystem::AddToRegistry(UObject* SaveableObject, int32& OutPriority)
+{
+	if (!SaveableObject || !SaveableObject->GetClass()->ImplementsInterface(USaveableInterface::StaticClass()))
+	{
+		return FString();
+	}
+
+	FString SaveID = ISaveableInterface::Execute_GetSaveID(SaveableObject);
+	if (SaveID.IsEmpty() || RegisteredSaveables.Contains(SaveID))
+	{
+		return FString();
+	}
+
+	// Priority is fixed for the registration's lifetime - the only interface call it costs
+	OutPriority = ISaveableInterface::Execute_GetSavePriority(SaveableObject);
+
+	RegisteredSaveables.Add(SaveID, SaveableObject);
+	CachedPriorities.Add(SaveID, OutPriority);
+
+	// Changes made before registration (e.g. during initialization) were not pushed
+	if (ISaveableInterface::Execute_IsDirty(SaveableObject))
+	{
+		DirtySaveIDs.Add(SaveID);
+	}
+
+	return SaveID;
+}
+
+void USaveableRegistrySubsystem::InsertSorted(int32 Priority, const FString& SaveID)
+{
+	// Ascending: lower priority number = loads first
+	const int32 Index = Algo::UpperBoundBy(PrioritySortedIDs, Priority, SaveableRegistryPrivate::FPriorityProjection());
+	PrioritySortedIDs.Insert(TPair<int32, FString>(Priority, SaveID), Index);
+}
+
+void USaveableRegistrySubsystem::RemoveSorted(int32 Priority, const FString& SaveID)
+{
+	const int32 First = Algo::LowerBoundBy(PrioritySortedIDs, Priority, SaveableRegistryPrivate::FPriorityProjection());
+	for (int32 Index = First; Index < PrioritySortedIDs.Num() && PrioritySortedIDs[Index].Key == Priority; ++Index)
+	{
+		if (PrioritySortedIDs[Index].Value == SaveID)
+		{
+			PrioritySortedIDs.RemoveAt(Index, EAllowShrinking::No);
+			return;
+		}
+	}
 }
 
 TArray<UObject*> USaveableRegistrySubsystem::GetSortedObjects() const
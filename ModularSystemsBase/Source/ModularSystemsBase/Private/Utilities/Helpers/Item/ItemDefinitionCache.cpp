@@ -0,0 +1,209 @@
+// ItemDefinitionCache.cpp
+// Location: ModularSystemsBase/Private/Utilities/Helpers/Item/ItemDefinitionCache.cpp
+
+#include "Utilities/Helpers/Item/ItemDefinitionCache.h"
+#include "Engine/DataTable.h"
+#include "Lib/Data/Tags/WW_TagLibrary.h"
+#include "UObject/UObjectGlobals.h"
+
+TMap<TObjectKey<UDataTable>, TUniquePtr<FItemDefinitionCache>> FItemDefinitionCache::Caches;
+FDelegateHandle FItemDefinitionCache::PostGarbageCollectHandle;
+
+FItemDefinitionCache::FItemDefinitionCache(const UDataTable* InTable)
+	: Table(InTable)
+{
+	// Reimports and editor edits can reallocate rows without changing the row count
+	if (UDataTable* DataTable = const_cast<UDataTable*>(InTable))
+	{
+		TableChangedHandle = DataTable->OnDataTableChanged().AddRaw(this, &FItemDefinitionCache::HandleTableChanged);
+	}
+}
+
+FItemDefinitionCache::~FItemDefinitionCache()
+{
+	// Weak pointers can't be resolved once the UObject system is gone
+	if (!UObjectInitialized())
+	{
+		return;
+	}
+
+	if (UDataTable* DataTable = const_cast<UDataTable*>(Table.Get()))
+	{
+		DataTable->OnDataTableChanged().Remove(TableChangedHandle);
+	}
+}
+
+FItemDefinitionCache& FItemDefinitionCache::Get(const UDataTable* ItemTable)
+{
+	check(IsInGameThread());
+
+	if (!PostGarbageCollectHandle.IsValid())
+	{
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&FItemDefinitionCache::PurgeStaleCaches);
+	}
+
+	TUniquePtr<FItemDefinitionCache>& Cache = Caches.FindOrAdd(ItemTable);
+	if (!Cache)
+	{
+		Cache = TUniquePtr<FItemDefinitionCache>(new FItemDefinitionCache(ItemTable));
+	}
+	return *Cache;
+}
+
+void FItemDefinitionCache::Invalidate(const UDataTable* ItemTable)
+{
+	if (TUniquePtr<FItemDefinitionCache>* Cache = Caches.Find(ItemTable))
+	{
+		(*Cache)->MarkStale();
+	}
+}
+
+void FItemDefinitionCache::ReleaseAll()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	PostGarbageCollectHandle.Reset();
+	Caches.Empty();
+}
+
+void FItemDefinitionCache::MarkStale()
+{
+	// Row pointers may already dangle - never hand them out again
+	Rows.Reset();
+	HotData.Reset();
+	IndexByItemID.Reset();
+	bBuilt = false;
+	Generation++;
+}
+
+void FItemDefinitionCache::HandleTableChanged()
+{
+	MarkStale();
+}
+
+void FItemDefinitionCache::PurgeStaleCaches()
+{
+	for (auto It = Caches.CreateIterator(); It; ++It)
+	{
+		if (!It.Value()->Table.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+uint8 FItemDefinitionCache::GetRarityOrdinal(const FGameplayTag& RarityTag)
+{
+	if (!RarityTag.IsValid())
+		return 0;
+
+	// Highest first, same order as FItemData::GetRarityColor
+	if (RarityTag.MatchesTag(FWWTagLibrary::Item_Rarity_Legendary())) return 5;
+	if (RarityTag.MatchesTag(FWWTagLibrary::Item_Rarity_Epic()))      return 4;
+	if (RarityTag.MatchesTag(FWWTagLibrary::Item_Rarity_Rare()))      return 3;
+	if (RarityTag.MatchesTag(FWWTagLibrary::Item_Rarity_Uncommon()))  return 2;
+	if (RarityTag.MatchesTag(FWWTagLibrary::Item_Rarity_Common()))    return 1;
+	return 0;
+}
+
+void FItemDefinitionCache::Build()
+{
+	Rows.Reset();
+	HotData.Reset();
+	IndexByItemID.Reset();
+
+	const UDataTable* DataTable = Table.Get();
+	const UScriptStruct* RowStruct = DataTable ? DataTable->GetRowStruct() : nullptr;
+	if (!RowStruct || !RowStruct->IsChildOf(FItemData::StaticStruct()))
+	{
+		bBuilt = true;
+		BuiltRowCount = 0;
+		return;
+	}
+
+	const TMap<FName, uint8*>& RowMap = DataTable->GetRowMap();
+	Rows.Reserve(RowMap.Num());
+	HotData.Reserve(RowMap.Num());
+	IndexByItemID.Reserve(RowMap.Num());
+
+	for (const TPair<FName, uint8*>& Pair : RowMap)
+	{
+		const FItemData* Row = reinterpret_cast<const FItemData*>(Pair.Value);
+		if (!Row)
+			continue;
+
+		FItemDefinitionHotData& Hot = HotData.AddDefaulted_GetRef();
+		Hot.MaxStackSize = Row->MaxStackSize;
+		Hot.BaseValue = Row->BaseValue;
+		Hot.Weight = Row->Weight;
+		Hot.RarityOrdinal = GetRarityOrdinal(Row->Rarity);
+		Hot.bIsStackable = Row->IsStackable();
+
+		IndexByItemID.Add(Pair.Key, Rows.Add(Row));
+	}
+
+	bBuilt = true;
+	BuiltRowCount = RowMap.Num();
+}
+
+void FItemDefinitionCache::EnsureBuilt()
+{
+	const UDataTable* DataTable = Table.Get();
+	const int32 CurrentRowCount = DataTable ? DataTable->GetRowMap().Num() : 0;
+
+	// Rows added/removed by a path that did not broadcast OnDataTableChanged - treat as a reload
+	if (bBuilt && CurrentRowCount != BuiltRowCount)
+	{
+		MarkStale();
+	}
+
+	if (!bBuilt)
+	{
+		Build();
+	}
+}
+
+FItemDefinitionHandle FItemDefinitionCache::FindHandle(FName ItemID)
+{
+	FItemDefinitionHandle Handle;
+	if (ItemID.IsNone())
+		return Handle;
+
+	EnsureBuilt();
+
+	if (const int32* Index = IndexByItemID.Find(ItemID))
+	{
+		Handle.Index = *Index;
+		Handle.Generation = Generation;
+	}
+	return Handle;
+}
+
+const FItemData* FItemDefinitionCache::Resolve(FItemDefinitionHandle Handle)
+{
+	EnsureBuilt();
+
+	if (!bBuilt || Handle.Generation != Generation || !Rows.IsValidIndex(Handle.Index))
+		return nullptr;
+
+	return Rows[Handle.Index];
+}
+
+const FItemDefinitionHotData* FItemDefinitionCache::ResolveHotData(FItemDefinitionHandle Handle)
+{
+	EnsureBuilt();
+
+	if (!bBuilt || Handle.Generation != Generation || !HotData.IsValidIndex(Handle.Index))
+		return nullptr;
+
+	return &HotData[Handle.Index];
+}
+
+const FItemData* FItemDefinitionCache::Find(FName ItemID)
+{
+	return Resolve(FindHandle(ItemID));
+}
+
+const FItemDefinitionHotData* FItemDefinitionCache::FindHotData(FName ItemID)
+{
+	return ResolveHotData(FindHandle(ItemID));
+}
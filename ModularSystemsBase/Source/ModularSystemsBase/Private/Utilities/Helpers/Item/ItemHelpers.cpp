@@ -1,4 +1,5 @@
 #include "Utilities/Helpers/Item/ItemHelpers.h"
+#include "Utilities/Helpers/Item/ItemDefinitionCache.h"
 
 #include "Lib/Data/ModularInventorySystem/InventoryData.h"
 #include "Debug/DebugSubsystem.h"
@@ -107,7 +108,8 @@ FInventorySlot UItemHelpers::CreateSlotFromItem(FName ItemID, int32 Quantity)
 int32 UItemHelpers::CalculateSlotValue(const FInventorySlot& Slot, UDataTable* ItemTable)
 {
 	if (Slot.ItemID.IsNone() || !ItemTable) return 0;
-	FItemData* ItemData = ItemTable->FindRow<FItemData>(Slot.ItemID, TEXT("GetItemData"));
+	const FItemDefinitionHotData* ItemData = FItemDefinitionCache::Get(ItemTable).FindHotData(Slot.ItemID);
+	if (!ItemData) return 0;
 	//TODO: Implement the modifications from the economy module later.
 	return ItemData->BaseValue * Slot.Quantity;
 	
@@ -116,7 +118,8 @@ int32 UItemHelpers::CalculateSlotValue(const FInventorySlot& Slot, UDataTable* I
 float UItemHelpers::CalculateSlotWeight(const FInventorySlot& Slot, UDataTable* ItemTable)
 {
 	if (!Slot.ItemID.IsValid() || !ItemTable) return 0;
-	FItemData* ItemData = ItemTable->FindRow<FItemData>(Slot.ItemID, TEXT("GetItemData"));
+	const FItemDefinitionHotData* ItemData = FItemDefinitionCache::Get(ItemTable).FindHotData(Slot.ItemID);
+	if (!ItemData) return 0;
 	//TODO: implement weight calculation logic here.
 	return ItemData->Weight * Slot.Quantity;
 		
@@ -125,13 +128,13 @@ float UItemHelpers::CalculateSlotWeight(const FInventorySlot& Slot, UDataTable*
 int32 UItemHelpers::GetItemValue(const FName& ItemID, UDataTable* ItemTable)
 {
 	if (!ItemID.IsValid() || !ItemTable) return 0;
-	FItemData* ItemData = ItemTable->FindRow<FItemData>(ItemID, TEXT("GetItemData"));
-	return ItemData->BaseValue;
+	const FItemDefinitionHotData* ItemData = FItemDefinitionCache::Get(ItemTable).FindHotData(ItemID);
+	return ItemData ? ItemData->BaseValue : 0;
 }
 
 float UItemHelpers::GetItemWeight(const FName& ItemID, UDataTable* ItemTable)
 {
 	if (!ItemID.IsValid() || !ItemTable) return 0;
-	FItemData* ItemData = ItemTable->FindRow<FItemData>(ItemID, TEXT("GetItemData"));
-	return ItemData->Weight;
+	const FItemDefinitionHotData* ItemData = FItemDefinitionCache::Get(ItemTable).FindHotData(ItemID);
+	return ItemData ? ItemData->Weight : 0.f;
 }
\ No newline at end of file
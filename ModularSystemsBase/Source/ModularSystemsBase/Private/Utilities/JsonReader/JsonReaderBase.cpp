@@ -10,6 +10,7 @@
 #include "Serialization/JsonReader.h"
 #include "HAL/PlatformFileManager.h"
 #include "Interfaces/IPluginManager.h"
+#include "Utilities/Helpers/Item/ItemDefinitionCache.h"
 
 #if WITH_EDITOR
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -164,8 +165,9 @@ bool UJsonReaderBase::PopulateDataTableFromJson(
         return false;
     }
     
-    // Clear existing rows
+    // Clear existing rows (row memory is freed - cached definition pointers go stale)
     DataTable->EmptyTable();
+    FItemDefinitionCache::Invalidate(DataTable);
     
     int32 SuccessCount = 0;
     int32 FailCount = 0;
@@ -2,18 +2,172 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "UObject/ObjectKey.h"
 #include "Delegates/ModularQuestSystem/GameplayEventDelegates.h"
 #include "Lib/Data/ModularQuestSystem/GameplayEventData.h"
 #include "EventBusSubsystem.generated.h"
 
+/** One tag subscription: exactly one of the handlers is bound */
+struct FEventBusSubscription
+{
+    int32 Id = INDEX_NONE;
+    FGameplayTag FilterTag;
+    FGameplayEventCallback DynamicHandler;
+    FGameplayEventNativeHandler NativeHandler;
+
+    /** Queued events: only receive the newest per (tag, target) in the queue */
+    bool bCoalesceQueued = false;
+
+    /** Cleared on unsubscribe so an in-flight dispatch skips it */
+    bool bActive = true;
+
+    const UObject* GetOwner() const;
+    void Dispatch(const FGameplayEventPayload& Payload) const;
+};
+
+using FEventBusSubscriptionRef = TSharedRef<FEventBusSubscription>;
+
+/**
+ * Tag-indexed subscription table behind UEventBusSubsystem (game thread).
+ *
+ * A subscription to a tag receives that tag and all its children. Routes map an
+ * event tag to every matching subscription and are kept up to date on subscribe/
+ * unsubscribe, so a broadcast only touches the handlers it actually reaches.
+ */
+class MODULARSYSTEMSBASE_API FEventBusRouter
+{
+public:
+    /** @return subscription id */
+    int32 Add(FGameplayTag FilterTag, FGameplayEventCallback DynamicHandler, FGameplayEventNativeHandler NativeHandler,
+        bool bCoalesceQueued = false);
+
+    bool Remove(int32 Id);
+
+    /** Remove every subscription whose handler is bound to Owner. @return number removed */
+    int32 RemoveAll(const UObject* Owner);
+
+    /**
+     * Call every matching handler in subscription order. Handlers may subscribe/unsubscribe re-entrantly.
+     * @param bSuperseded - A newer queued event has the same (tag, target); coalescing subscriptions skip this one
+     */
+    void Dispatch(const FGameplayEventPayload& Payload, bool bSuperseded = false);
+
+    int32 Num() const { return Subscriptions.Num(); }
+    void Reset();
+
+private:
+    /** Matching subscriptions for an event tag, built from its parent chain on first use */
+    const TArray<FEventBusSubscriptionRef>& ResolveRoute(const FGameplayTag& EventTag);
+
+    TMap<int32, FEventBusSubscriptionRef> Subscriptions;
+
+    /** Filter tag -> subscriptions on exactly that tag */
+    TMap<FGameplayTag, TArray<FEventBusSubscriptionRef>> ByFilterTag;
+
+    /** Event tag -> resolved subscriptions (filter tag is the event tag or one of its parents), by id */
+    TMap<FGameplayTag, TArray<FEventBusSubscriptionRef>> Routes;
+
+    int32 NextId = 0;
+};
+
+/** An event waiting in the EventBus queue */
+struct FQueuedGameplayEvent
+{
+    FGameplayEventPayload Payload;
+    uint64 Sequence = 0;
+    double QueuedTime = 0.0;
+};
+
+/**
+ * Growable ring buffer of queued events (game thread).
+ * Events left over when a flush runs out of budget stay at the front for the next frame.
+ */
+class MODULARSYSTEMSBASE_API FEventBusQueue
+{
+public:
+    void Push(FQueuedGameplayEvent&& Event);
+
+    /** Move the oldest event out. Queue must not be empty. */
+    FQueuedGameplayEvent Pop();
+
+    int32 Num() const { return Count; }
+    bool IsEmpty() const { return Count == 0; }
+    void Reset();
+
+    /** Visit every queued event (GC reference reporting) */
+    template <typename FuncType>
+    void ForEach(FuncType&& Func)
+    {
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Func(Slots[(Head + i) & (Slots.Num() - 1)]);
+        }
+    }
+
+private:
+    void Grow();
+
+    /** Power-of-two capacity */
+    TArray<FQueuedGameplayEvent> Slots;
+    int32 Head = 0;
+    int32 Count = 0;
+};
+
+/** Queue counters, updated every flush */
+USTRUCT(BlueprintType)
+struct MODULARSYSTEMSBASE_API FEventBusQueueStats
+{
+    GENERATED_BODY()
+
+    /** Events waiting right now */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Bus|Queue")
+    int32 QueueDepth = 0;
+
+    /** Highest depth seen since the stats were reset */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Bus|Queue")
+    int32 PeakQueueDepth = 0;
+
+    /** Events dispatched by the last flush */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Bus|Queue")
+    int32 LastFlushDispatched = 0;
+
+    /** Events the last flush left for the next frame (budget exhausted) */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Bus|Queue")
+    int32 LastFlushCarriedOver = 0;
+
+    /** Queue-to-dispatch latency of the last flush */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Bus|Queue")
+    float LastFlushMaxLatencyMs = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Bus|Queue")
+    float LastFlushAvgLatencyMs = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Bus|Queue")
+    float LastFlushDurationMs = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Bus|Queue")
+    int64 TotalQueued = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Bus|Queue")
+    int64 TotalDispatched = 0;
+
+    /** Deliveries skipped by coalescing subscriptions */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Bus|Queue")
+    int64 TotalSuperseded = 0;
+};
+
 /**
  * Central event bus for cross-plugin communication.
  * Single API for broadcasting gameplay events.
+ *
+ * Listeners subscribe by tag (SubscribeToEvent / SubscribeNative) and only
+ * receive matching events. OnGameplayEvent still receives everything.
  */
 
 
 UCLASS()
-class MODULARSYSTEMSBASE_API UEventBusSubsystem : public UGameInstanceSubsystem
+class MODULARSYSTEMSBASE_API UEventBusSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
     GENERATED_BODY()
 
@@ -23,6 +177,16 @@ public:
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
 
+    static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+    // Tickable interface - flushes the event queue once per frame, after the world's tick groups
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual bool IsTickable() const override { return !EventQueue.IsEmpty(); }
+    virtual bool IsTickableInEditor() const override { return false; }
+    virtual bool IsTickableWhenPaused() const override { return false; }
+    virtual UWorld* GetTickableGameObjectWorld() const override { return GetGameInstance() ? GetGameInstance()->GetWorld() : nullptr; }
+
     /** Get EventBus from any world context */
     UFUNCTION(BlueprintPure, Category = "Event Bus", meta = (WorldContext = "WorldContextObject"))
     static UEventBusSubsystem* Get(const UObject* WorldContextObject);
@@ -45,6 +209,53 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Event Bus")
     void BroadcastSimpleEvent(FGameplayTag EventTag, AActor* Instigator = nullptr, float Value = 0.0f);
 
+    // === QUEUED DISPATCH ===
+
+    /**
+     * Deferred BroadcastEvent: the event is dispatched at the end of the frame, within QueueFlushBudgetMs.
+     * For bursts (loot explosions, mass pickups) where listeners don't need the event synchronously.
+     * Subscriptions made with bCoalesceQueued only see the newest queued event per (tag, target).
+     */
+    UFUNCTION(BlueprintCallable, Category = "Event Bus|Queue")
+    void QueueEvent(const FGameplayEventPayload& Payload);
+
+    /** Dispatch queued events now, within the budget (0 = everything queued before the call) */
+    UFUNCTION(BlueprintCallable, Category = "Event Bus|Queue")
+    int32 FlushQueuedEvents(float BudgetMs = 0.f);
+
+    UFUNCTION(BlueprintPure, Category = "Event Bus|Queue")
+    FEventBusQueueStats GetQueueStats() const { return QueueStats; }
+
+    UFUNCTION(BlueprintCallable, Category = "Event Bus|Queue")
+    void ResetQueueStats();
+
+    /** Per-frame time budget for the end-of-frame flush; events over budget wait for the next frame */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Event Bus|Queue", meta = (ClampMin = "0.05"))
+    float QueueFlushBudgetMs = 1.0f;
+
+    // === SUBSCRIPTIONS ===
+
+    /**
+     * Receive events matching a tag (the tag itself and all its children).
+     * Preferred over binding OnGameplayEvent and filtering in the handler.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Event Bus")
+    FEventBusSubscriptionHandle SubscribeToEvent(FGameplayTag EventTag, FGameplayEventCallback Callback, bool bCoalesceQueued = false);
+
+    /** C++ variant of SubscribeToEvent - no reflection, receives the full payload */
+    FEventBusSubscriptionHandle SubscribeNative(FGameplayTag EventTag, FGameplayEventNativeHandler Handler, bool bCoalesceQueued = false);
+
+    /** @return true if the subscription existed */
+    UFUNCTION(BlueprintCallable, Category = "Event Bus")
+    bool Unsubscribe(UPARAM(ref) FEventBusSubscriptionHandle& Handle);
+
+    /** Drop every subscription bound to an object (e.g. in EndPlay) */
+    UFUNCTION(BlueprintCallable, Category = "Event Bus")
+    int32 UnsubscribeAll(const UObject* Listener);
+
+    UFUNCTION(BlueprintPure, Category = "Event Bus")
+    int32 GetSubscriptionCount() const { return Router.Num(); }
+
     // === DELEGATES ===
     
     /** Universal gameplay event delegate - bind to receive all events */
@@ -61,4 +272,17 @@ public:
 protected:
     /** Log event for debugging */
     void LogEvent(const FGameplayEventPayload& Payload) const;
+
+    /** Router + OnGameplayEvent */
+    void DispatchEvent(const FGameplayEventPayload& Payload, bool bSuperseded);
+
+private:
+    FEventBusRouter Router;
+
+    FEventBusQueue EventQueue;
+    FEventBusQueueStats QueueStats;
+    uint64 NextQueueSequence = 0;
+
+    /** (tag, target) -> sequence of the newest queued event with that key */
+    TMap<TPair<FGameplayTag, FObjectKey>, uint64> NewestQueuedByKey;
 };
\ No newline at end of file
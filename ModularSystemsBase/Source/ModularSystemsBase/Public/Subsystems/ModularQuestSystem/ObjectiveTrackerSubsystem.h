@@ -5,8 +5,11 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "GameplayTagContainer.h"
 #include "Lib/Data/Core/ObjectiveData.h"
+#include "Lib/Data/ModularQuestSystem/GameplayEventData.h"
 #include "ObjectiveTrackerSubsystem.generated.h"
 
+class UEventBusSubsystem;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnObjectiveUpdated, const FGuid&, SetID, const FGameplayTag&, ObjectiveTag, float, NewValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnObjectiveMet, const FGuid&, SetID, const FGameplayTag&, ObjectiveTag, float, MetTimestamp);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnObjectiveSetComplete, const FGuid&, SetID, bool, bBonusAchieved);
@@ -15,6 +18,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnObjectiveSetFailed, const FGuid&,
 /**
  * Shared objective tracking for MiniGame and Quest systems
  * Owns runtime state; consumers register sets and listen to delegates
+ * Sets registered with an event instigator also advance from matching EventBus events
  */
 UCLASS()
 class MODULARSYSTEMSBASE_API UObjectiveTrackerSubsystem : public UGameInstanceSubsystem
@@ -27,9 +31,13 @@ public:
 
     // === REGISTRATION ===
 
-    /** Register objective set, returns unique SetID */
+    /**
+     * Register objective set, returns unique SetID
+     * @param EventInstigator - If set, EventBus events this actor instigates on an objective's tag (or a child)
+     *                          add to that objective: Value, else IntValue, else 1
+     */
     UFUNCTION(BlueprintCallable, Category = "Objectives")
-    FGuid RegisterObjectiveSet(const FObjectiveSet& Definition);
+    FGuid RegisterObjectiveSet(const FObjectiveSet& Definition, AActor* EventInstigator = nullptr);
 
     /** Unregister objective set */
     UFUNCTION(BlueprintCallable, Category = "Objectives")
@@ -53,6 +61,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Objectives")
     void CompleteObjective(const FGuid& SetID, const FGameplayTag& ObjectiveTag);
 
+    /**
+     * Update every tracked objective that listens to a gameplay tag (additive)
+     * An objective on A.B receives A.B and its children (A.B.C). Only the matching objectives are touched.
+     * @return number of objectives updated
+     */
+    UFUNCTION(BlueprintCallable, Category = "Objectives")
+    int32 AddObjectiveValueForTag(const FGameplayTag& EventTag, float Delta);
+
+    /** Absolute variant of AddObjectiveValueForTag */
+    UFUNCTION(BlueprintCallable, Category = "Objectives")
+    int32 SetObjectiveValueForTag(const FGameplayTag& EventTag, float Value);
+
     /** Reset single objective */
     UFUNCTION(BlueprintCallable, Category = "Objectives")
     void ResetObjective(const FGuid& SetID, const FGameplayTag& ObjectiveTag);
@@ -91,6 +111,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "Objectives")
     float GetSetProgress(const FGuid& SetID) const;
 
+    /** Sets with at least one objective matching the tag (the tag or one of its parents) */
+    UFUNCTION(BlueprintCallable, Category = "Objectives")
+    TArray<FGuid> GetSetsForTag(const FGameplayTag& EventTag) const;
+
     /** Get tracked set by ID (returns nullptr if not found) */
     const FTrackedObjectiveSet* GetTrackedSet(const FGuid& SetID) const;
 
@@ -113,9 +137,46 @@ private:
     UPROPERTY()
     TMap<FGuid, FTrackedObjectiveSet> TrackedSets;
 
+    /** One objective inside a tracked set */
+    struct FObjectiveRef
+    {
+        FGuid SetID;
+        int32 EntryIndex = INDEX_NONE;
+    };
+
+    /** Objective tag -> every tracked objective on exactly that tag. Maintained on register/unregister. */
+    TMap<FGameplayTag, TArray<FObjectiveRef>> ObjectivesByTag;
+
+    void IndexSet(const FTrackedObjectiveSet& Set);
+    void UnindexSet(const FTrackedObjectiveSet& Set);
+
+    /** Sets fed from the EventBus -> the actor whose events count for them */
+    TMap<FGuid, TWeakObjectPtr<AActor>> EventInstigators;
+
+    /** One EventBus subscription per indexed objective tag, added and dropped with its ObjectivesByTag entry */
+    TMap<FGameplayTag, FEventBusSubscriptionHandle> EventSubscriptions;
+
+    UPROPERTY()
+    TObjectPtr<UEventBusSubsystem> CachedEventBus;
+
+    /** Set while an event is applied - objective delegates that broadcast events don't feed back in */
+    bool bApplyingEvent = false;
+
+    void SubscribeObjectiveTag(const FGameplayTag& ObjectiveTag);
+    void UnsubscribeObjectiveTag(const FGameplayTag& ObjectiveTag);
+
+    /** EventBus handler for one objective tag: the bus calls it once per matching subscription, so only that tag's objectives move */
+    void HandleObjectiveEvent(const FGameplayEventPayload& Payload, FGameplayTag ObjectiveTag);
+
+    /** Objectives listening to EventTag: its own entry plus each parent tag's */
+    void FindObjectivesForTag(const FGameplayTag& EventTag, TArray<FObjectiveRef>& OutRefs) const;
+
     /** Internal update with completion check */
     void UpdateObjectiveInternal(const FGuid& SetID, const FGameplayTag& ObjectiveTag, float NewValue);
 
+    /** Internal update by entry index (index path for tag-routed updates) */
+    void UpdateObjectiveAt(const FGuid& SetID, int32 EntryIndex, float NewValue);
+
     /** Check and broadcast completion if needed */
     void CheckCompletion(const FGuid& SetID);
 
@@ -18,6 +18,8 @@ class ISaveableInterface;
  * to discover what needs saving.
  *
  * Provides priority-sorted iteration (Rule #39) and dirty-only queries (Rule #40).
+ * Dirty tracking is push-based: saveables call MarkSaveableDirty when they change,
+ * and dirty queries only visit that set.
  */
 UCLASS()
 class MODULARSYSTEMSBASE_API USaveableRegistrySubsystem : public UGameInstanceSubsystem
@@ -41,6 +43,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Save System|Registry")
 	bool RegisterSaveable(UObject* SaveableObject);
 
+	/** Register many saveables at once (level streaming). The priority order is re-sorted once for the batch.
+	 *  @return number of objects registered */
+	UFUNCTION(BlueprintCallable, Category = "Save System|Registry")
+	int32 RegisterSaveables(const TArray<UObject*>& SaveableObjects);
+
 	/** Unregister a saveable object by its SaveID.
 	 *  @return true if found and removed */
 	UFUNCTION(BlueprintCallable, Category = "Save System|Registry")
@@ -52,7 +59,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Save System|Registry")
 	TArray<UObject*> GetAllSaveables() const;
 
-	/** Get only dirty saveables, sorted by priority ascending */
+	/** Get only dirty saveables, sorted by priority ascending (visits the pushed dirty set only) */
 	UFUNCTION(BlueprintCallable, Category = "Save System|Registry")
 	TArray<UObject*> GetDirtySaveables() const;
 
@@ -64,10 +71,29 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Save System|Registry")
 	int32 GetSaveableCount() const;
 
-	/** Call ClearDirty() on all registered saveables */
+	/** Call ClearDirty() on every saveable in the dirty set and empty it */
 	UFUNCTION(BlueprintCallable, Category = "Save System|Registry")
 	void MarkAllClean();
 
+	// === DIRTY TRACKING ===
+
+	/** Push a changed saveable into the dirty set. Call when the saveable's own dirty flag goes up.
+	 *  A component also marks its owning actor when the owner is a registered saveable. */
+	UFUNCTION(BlueprintCallable, Category = "Save System|Registry")
+	void MarkSaveableDirty(UObject* SaveableObject);
+
+	/** Raise a saveable's own dirty flag and, on the rising edge only, push it to its world's registry.
+	 *  Shared body of every saveable's MarkSaveDirty. */
+	static void PushDirty(UObject* SaveableObject, bool& bDirtyFlag);
+
+	/** Call ClearDirty() on one saveable and drop it from the dirty set (after saving it alone) */
+	UFUNCTION(BlueprintCallable, Category = "Save System|Registry")
+	void MarkSaveableClean(UObject* SaveableObject);
+
+	/** Number of saveables pushed dirty since they were last cleaned */
+	UFUNCTION(BlueprintPure, Category = "Save System|Registry")
+	int32 GetDirtyCount() const { return DirtySaveIDs.Num(); }
+
 	// === DELEGATES ===
 
 	UPROPERTY(BlueprintAssignable, Category = "Save System|Registry")
@@ -76,16 +102,34 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Save System|Registry")
 	FOnSaveableUnregistered OnSaveableUnregistered;
 
+	/** Broadcast by the save system once a loaded save has been restored (native listeners that derive state from it) */
+	FSimpleMulticastDelegate OnStateRestored;
+
 private:
 	/** SaveID → Weak reference to saveable object */
 	UPROPERTY()
 	TMap<FString, TWeakObjectPtr<UObject>> RegisteredSaveables;
 
-	/** Cached priority-sorted list: (Priority, SaveID) pairs */
+	/** SaveID → priority, read once at registration */
+	TMap<FString, int32> CachedPriorities;
+
+	/** Priority-sorted list: (Priority, SaveID) pairs, registration order within a priority */
 	TArray<TPair<int32, FString>> PrioritySortedIDs;
 
-	/** Rebuild the priority cache after register/unregister */
-	void RebuildPriorityCache();
+	/** SaveIDs pushed through MarkSaveableDirty, drained by MarkAllClean / MarkSaveableClean */
+	TSet<FString> DirtySaveIDs;
+
+	/** Add to DirtySaveIDs if registered; returns false otherwise */
+	bool AddDirty(UObject* SaveableObject);
+
+	/** Validate and add to the map; returns the SaveID, empty if rejected. Does not touch PrioritySortedIDs. */
+	FString AddToRegistry(UObject* SaveableObject, int32& OutPriority);
+
+	/** Sorted insert after any equal priorities */
+	void InsertSorted(int32 Priority, const FString& SaveID);
+
+	/** Binary search to the priority, then scan its run for the ID */
+	void RemoveSorted(int32 Priority, const FString& SaveID);
 
 	/** Get objects from priority-sorted IDs, filtering out stale weak refs */
 	TArray<UObject*> GetSortedObjects() const;
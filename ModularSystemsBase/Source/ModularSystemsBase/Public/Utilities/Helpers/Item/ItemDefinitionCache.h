@@ -0,0 +1,113 @@
+// ItemDefinitionCache.h
+// Location: ModularSystemsBase/Public/Utilities/Helpers/Item/ItemDefinitionCache.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "Lib/Data/ModularInventorySystem/InventoryData.h"
+
+class UDataTable;
+
+/**
+ * Compact reference to a cached item definition
+ * Index addresses the cache's packed arrays; Generation detects stale handles after a table reload.
+ */
+struct FItemDefinitionHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Generation = 0;
+
+    bool IsSet() const { return Index != INDEX_NONE; }
+};
+
+/** Hot per-definition fields, packed so per-frame inventory logic never touches the full row */
+struct FItemDefinitionHotData
+{
+    int32 MaxStackSize = 1;
+    int32 BaseValue = 0;
+    float Weight = 0.f;
+    uint8 RarityOrdinal = 0;    // 0 = none, 1 = Common ... 5 = Legendary
+    bool bIsStackable = false;  // FItemData::IsStackable() (quest items never stack)
+};
+
+/**
+ * Process-wide, read-only cache of FItemData rows (one instance per item DataTable)
+ *
+ * - Resolves an ItemID once to a stable const row pointer + integer handle
+ * - Hot fields live in a packed array indexed by handle
+ * - A table reload (JsonReaderBase repopulate, reimport or editor edit via OnDataTableChanged,
+ *   or Invalidate) bumps the generation; handles from an older generation resolve to nullptr
+ *   and must be re-fetched by ID
+ * - Caches of garbage-collected tables are dropped after each GC
+ *
+ * Game thread only.
+ */
+class MODULARSYSTEMSBASE_API FItemDefinitionCache
+{
+public:
+    /** Cache for a table (created on first use) */
+    static FItemDefinitionCache& Get(const UDataTable* ItemTable);
+
+    /** Mark a table's cache stale (bumps its generation) - call after its rows were rebuilt */
+    static void Invalidate(const UDataTable* ItemTable);
+
+    /** Destroy every cache and unbind from GC (module shutdown, before UObject teardown) */
+    static void ReleaseAll();
+
+    /** ItemID -> handle (one map lookup; builds the cache lazily on first call) */
+    FItemDefinitionHandle FindHandle(FName ItemID);
+
+    /** Handle -> row. Returns nullptr for stale or unset handles (including ones a rebuild just invalidated) */
+    const FItemData* Resolve(FItemDefinitionHandle Handle);
+
+    /** Handle -> packed hot fields. Returns nullptr for stale or unset handles */
+    const FItemDefinitionHotData* ResolveHotData(FItemDefinitionHandle Handle);
+
+    /** Rebuild if the table changed behind our back - call before comparing a held handle's generation */
+    void EnsureBuilt();
+
+    /** Convenience: ItemID -> row */
+    const FItemData* Find(FName ItemID);
+
+    /** Convenience: ItemID -> hot fields */
+    const FItemDefinitionHotData* FindHotData(FName ItemID);
+
+    uint32 GetGeneration() const { return Generation; }
+    int32 Num() const { return Rows.Num(); }
+
+    /** Rarity tag -> ordinal used by FItemDefinitionHotData */
+    static uint8 GetRarityOrdinal(const FGameplayTag& RarityTag);
+
+    ~FItemDefinitionCache();
+
+private:
+    explicit FItemDefinitionCache(const UDataTable* InTable);
+
+    /** Drop the packed arrays and bump the generation */
+    void MarkStale();
+
+    /** Bound to the table's OnDataTableChanged - rows may have been reallocated */
+    void HandleTableChanged();
+
+    /** Remove caches whose table was garbage collected */
+    static void PurgeStaleCaches();
+
+    /** (Re)build every packed array from the table */
+    void Build();
+
+    TWeakObjectPtr<const UDataTable> Table;
+    uint32 Generation = 1;
+    bool bBuilt = false;
+    int32 BuiltRowCount = 0;
+
+    // Packed, index-aligned
+    TArray<const FItemData*> Rows;
+    TArray<FItemDefinitionHotData> HotData;
+    TMap<FName, int32> IndexByItemID;
+
+    FDelegateHandle TableChangedHandle;
+
+    static FDelegateHandle PostGarbageCollectHandle;
+    static TMap<TObjectKey<UDataTable>, TUniquePtr<FItemDefinitionCache>> Caches;
+};
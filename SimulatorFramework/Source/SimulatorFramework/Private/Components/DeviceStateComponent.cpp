@@ -539,5 +539,5 @@ void UDeviceStateComponent::OnSaveDataLoaded_Implementation()
 
 void UDeviceStateComponent::MarkSaveDirty()
 {
-    bSaveDirty = true;
+    USaveableRegistrySubsystem::PushDirty(this, bSaveDirty);
 }
\ No newline at end of file
@@ -1039,7 +1039,7 @@ void UTimeTrackingSubsystem::CmdCancelSleep(const TArray<FString>& Args, UWorld*
 
 void UTimeTrackingSubsystem::MarkSaveDirty()
 {
-	bSaveDirty = true;
+	USaveableRegistrySubsystem::PushDirty(this, bSaveDirty);
 }
 
 FString UTimeTrackingSubsystem::GetSaveID_Implementation() const
@@ -19,3 +19,8 @@ DECLARE_DYNAMIC_DELEGATE_ThreeParams(
 	UObject*, Payload
 );
 
+/** Native (non-dynamic) handler for C++ systems - receives the full payload, no Blueprint VM */
+DECLARE_DELEGATE_OneParam(
+	FGameplayEventNativeHandler,
+	const FGameplayEventPayload& /*Payload*/
+);
@@ -45,6 +45,12 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
 	FName, QuestID,
 	AActor*, Player);
 
+/** Fires once per availability refresh with every quest that just became available for the player */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
+	FOnQuestAvailabilityChanged,
+	AActor*, Player,
+	const TArray<FName>&, NewlyAvailable);
+
 /** Fires when a quest objective progresses (forwarded from ObjectiveTracker) */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(
 	FOnQuestObjectiveProgress,
@@ -30,6 +30,17 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
 	bool, bSuccess,
 	const FString&, SaveSlotName);
 
+/** Broadcast as a background save moves through its stages (Progress 0..1, game thread) */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
+	FOnMasterSaveProgress,
+	const FString&, SaveSlotName,
+	float, Progress);
+
+/** Broadcast when the save slot catalogue has been re-read from the metadata sidecars (game thread) */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
+	FOnSaveSlotCatalogueRefreshed,
+	int32, NumSlots);
+
 /** Broadcast when the master save game finishes loading */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
 	FOnMasterLoadComplete,
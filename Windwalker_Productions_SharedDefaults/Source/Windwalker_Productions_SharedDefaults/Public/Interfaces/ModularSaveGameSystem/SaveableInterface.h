@@ -66,7 +66,8 @@ public:
 	// DIRTY TRACKING (Rule #40)
 	// ================================================================
 
-	/** Returns true if this object has unsaved changes since last ClearDirty(). */
+	/** Returns true if this object has unsaved changes since last ClearDirty().
+	 *  Implementations also push the change through USaveableRegistrySubsystem::PushDirty - the registry only checks what was pushed. */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Save System")
 	bool IsDirty() const;
 
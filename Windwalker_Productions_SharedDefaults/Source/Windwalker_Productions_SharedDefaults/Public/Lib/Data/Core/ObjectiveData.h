@@ -232,8 +232,13 @@ struct SHAREDDEFAULTS_API FTrackedObjectiveSet
     /** Update objective value and check if met */
     bool UpdateObjective(const FGameplayTag& ObjectiveTag, float NewValue, float WorldTime)
     {
-        int32 Index = Definition.FindEntryIndex(ObjectiveTag);
-        if (Index == INDEX_NONE || !States.IsValidIndex(Index)) return false;
+        return UpdateObjectiveAt(Definition.FindEntryIndex(ObjectiveTag), NewValue, WorldTime);
+    }
+
+    /** Update objective value by entry index and check if met */
+    bool UpdateObjectiveAt(int32 Index, float NewValue, float WorldTime)
+    {
+        if (!Definition.Entries.IsValidIndex(Index) || !States.IsValidIndex(Index)) return false;
 
         FObjectiveState& State = States[Index];
         const FObjectiveEntry& Entry = Definition.Entries[Index];
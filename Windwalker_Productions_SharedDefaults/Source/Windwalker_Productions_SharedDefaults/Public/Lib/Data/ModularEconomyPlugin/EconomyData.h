@@ -15,10 +15,14 @@ struct WINDWALKER_PRODUCTIONS_SHAREDDEFAULTS_API FEconomyTransaction
 {
 	GENERATED_BODY()
 
-	/** Amount of the transaction (positive = income, negative = expense) */
+	/** Amount of the transaction (positive = income, negative = expense). Display value of AmountMinor. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Economy")
 	float Amount = 0.f;
 
+	/** Exact amount in currency minor units (cents) - the value the ledger adds up */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Economy")
+	int64 AmountMinor = 0;
+
 	/** Category tag (Economy.Category.*) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Economy")
 	FGameplayTag Category;
@@ -37,7 +41,7 @@ struct WINDWALKER_PRODUCTIONS_SHAREDDEFAULTS_API FEconomyTransaction
 
 	bool IsValid() const
 	{
-		return Amount != 0.f;
+		return AmountMinor != 0 || Amount != 0.f;
 	}
 };
 
@@ -85,6 +85,24 @@ struct WINDWALKER_PRODUCTIONS_SHAREDDEFAULTS_API FGameplayEventPayload
     }
 };
 
+/**
+ * Identifies one tag subscription on the EventBus.
+ * Returned by subscribe calls, passed back to unsubscribe.
+ */
+USTRUCT(BlueprintType)
+struct WINDWALKER_PRODUCTIONS_SHAREDDEFAULTS_API FEventBusSubscriptionHandle
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 Id = INDEX_NONE;
+
+    bool IsValid() const { return Id != INDEX_NONE; }
+    void Reset() { Id = INDEX_NONE; }
+
+    bool operator==(const FEventBusSubscriptionHandle& Other) const { return Id == Other.Id; }
+};
+
 /**
  * Trigger definition for automatic event firing.
  * Placed on actors/components to fire events on conditions.